@@ -0,0 +1,45 @@
+#pragma once
+
+// Timing helpers for the standalone benchmarks in this folder.
+
+#include <chrono>
+#include <cstdio>
+
+namespace Bench
+{
+	// keeps the optimizer from dropping work whose result is never read
+	template<typename T>
+	inline void Keep(T& value)
+	{
+		asm volatile("" : : "r"(&value) : "memory");
+	}
+
+	// best of several runs, nanoseconds per call
+	template<typename TFunction>
+	double Measure(TFunction function, int iterations, int runs = 7)
+	{
+		double best = 0.0;
+		for (int run = 0; run < runs; ++run)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iterations; ++i)
+			{
+				function();
+			}
+			std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+			double perCall = elapsed.count() / iterations;
+			if (run == 0 ||
+				perCall < best)
+			{
+				best = perCall;
+			}
+		}
+		return best;
+	}
+
+	// items is the work done by one call, such as pixels or keys
+	inline void Report(const char* name, double nanoseconds, int items, const char* unit)
+	{
+		printf("%-40s %10.1f ns/call %10.1f M %s/s\r\n", name, nanoseconds, items * 1000.0 / nanoseconds, unit);
+	}
+}
@@ -0,0 +1,108 @@
+// Throughput of the batch color conversion in ChromaColor.cpp against the
+// per pixel conversion it replaced, in pixels per second.
+//
+// Builds the real ChromaColor.cpp on Linux through the stand-ins in Shim.
+// The batch kernels pick AVX2 or SSE2 at run time, the same as in the plugin.
+//
+// Build and run from this folder:
+//   g++ -std=c++14 -O2 -mavx2 -mxsave -include Shim/HarnessShim.h -IShim -I../Source/ChromaSDKPlugin/Public ColorBench.cpp ../Source/ChromaSDKPlugin/Private/ChromaColor.cpp -o ColorBench && ./ColorBench
+
+#include "Bench.h"
+#include "ChromaColor.h"
+#include <random>
+#include <vector>
+
+using namespace ChromaSDK;
+using namespace std;
+
+// one keyboard frame, and a whole animation worth of frames
+static const int KEYBOARD_PIXELS = Keyboard::MAX_ROW * Keyboard::MAX_COLUMN;
+static const int ANIMATION_PIXELS = KEYBOARD_PIXELS * 100;
+
+// the per pixel conversion the batch kernels replaced, truncates and does not clamp
+static int OldToBGR(const FLinearColor& color)
+{
+	int red = color.R * 255;
+	int green = color.G * 255;
+	int blue = color.B * 255;
+	return RGB(red, green, blue);
+}
+
+static FLinearColor OldToLinearColor(int color)
+{
+	float red = GetRValue(color) / 255.0f;
+	float green = GetGValue(color) / 255.0f;
+	float blue = GetBValue(color) / 255.0f;
+	return FLinearColor(red, green, blue, 1.0f);
+}
+
+static void Run(int count)
+{
+	mt19937 random(1234);
+	uniform_real_distribution<float> channel(0.0f, 1.0f);
+	vector<FLinearColor> linear(count);
+	vector<COLORREF> packed(count);
+	for (int i = 0; i < count; ++i)
+	{
+		linear[i] = FLinearColor(channel(random), channel(random), channel(random), 1.0f);
+	}
+
+	// in range inputs, both conversions agree except where truncation and rounding differ
+	Color::ToBGR(linear.data(), packed.data(), count);
+	for (int i = 0; i < count; ++i)
+	{
+		if (packed[i] != (COLORREF)Color::ToBGR(linear[i]))
+		{
+			printf("ColorBench: batch and single pixel ToBGR differ at %d!\r\n", i);
+			return;
+		}
+	}
+
+	char name[64];
+	printf("%d pixels\r\n", count);
+
+	double nanoseconds = Bench::Measure([&]()
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			packed[i] = OldToBGR(linear[i]);
+		}
+		Bench::Keep(packed);
+	}, 20000000 / count);
+	snprintf(name, sizeof(name), "  ToBGR per pixel (before)");
+	Bench::Report(name, nanoseconds, count, "pixels");
+
+	nanoseconds = Bench::Measure([&]()
+	{
+		Color::ToBGR(linear.data(), packed.data(), count);
+		Bench::Keep(packed);
+	}, 20000000 / count);
+	snprintf(name, sizeof(name), "  ToBGR batch");
+	Bench::Report(name, nanoseconds, count, "pixels");
+
+	nanoseconds = Bench::Measure([&]()
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			linear[i] = OldToLinearColor(packed[i]);
+		}
+		Bench::Keep(linear);
+	}, 20000000 / count);
+	snprintf(name, sizeof(name), "  ToLinearColor per pixel (before)");
+	Bench::Report(name, nanoseconds, count, "pixels");
+
+	nanoseconds = Bench::Measure([&]()
+	{
+		Color::ToLinearColor(packed.data(), linear.data(), count);
+		Bench::Keep(linear);
+	}, 20000000 / count);
+	snprintf(name, sizeof(name), "  ToLinearColor batch");
+	Bench::Report(name, nanoseconds, count, "pixels");
+}
+
+int main()
+{
+	Run(KEYBOARD_PIXELS);
+	Run(ANIMATION_PIXELS);
+	return 0;
+}
@@ -0,0 +1,177 @@
+// Cost of one keyboard HUD redraw through the Draw primitives in ChromaDraw.h
+// against setting the same cells one at a time, the way a blueprint drew
+// before the primitives existed, in microseconds per redraw.
+//
+// Builds the real ChromaDraw.cpp on Linux through the stand-ins in Shim.
+//
+// Build and run from this folder:
+//   g++ -std=c++14 -O2 -include Shim/HarnessShim.h -IShim -I../Source/ChromaSDKPlugin/Public DrawBench.cpp ../Source/ChromaSDKPlugin/Private/ChromaDraw.cpp -o DrawBench && ./DrawBench
+
+#include "Bench.h"
+#include "ChromaDraw.h"
+#include <vector>
+
+using namespace ChromaSDK;
+using namespace std;
+
+static const int KEYBOARD_ROWS = Keyboard::MAX_ROW;
+static const int KEYBOARD_COLUMNS = Keyboard::MAX_COLUMN;
+
+// health and ammo bars, a gradient banner, a crosshair, a radar blip and the background fill
+template<typename TGrid>
+static void DrawHud(const TGrid& grid, const typename TGrid::ColorType* palette)
+{
+	Draw::Rect(grid, 0, 0, grid.MaxRow, grid.MaxColumn, palette[0]);
+	Draw::HorizontalBar(grid, 0, 1, 0.7f, palette[1]);
+	Draw::VerticalBar(grid, grid.MaxColumn - 1, 1, 0.4f, palette[2]);
+	Draw::Gradient(grid, 1, 0, 1, grid.MaxColumn - 2, palette[3], palette[4]);
+	Draw::Line(grid, 2, 2, 5, 8, palette[5]);
+	Draw::Line(grid, 5, 2, 2, 8, palette[5]);
+	Draw::Circle(grid, 3.5f, 15.0f, 2.0f, palette[6]);
+	Draw::FloodFill(grid, grid.MaxRow - 1, 0, palette[7]);
+}
+
+// the same HUD written cell by cell into the blueprint color array
+static FLinearColor Lerp(const FLinearColor& a, const FLinearColor& b, float t)
+{
+	return FLinearColor(a.R + (b.R - a.R) * t, a.G + (b.G - a.G) * t, a.B + (b.B - a.B) * t, 1.0f);
+}
+
+static void DrawHudPerCell(TArray<FChromaSDKColors>& colors, const FLinearColor* palette)
+{
+	for (int i = 0; i < KEYBOARD_ROWS; ++i)
+	{
+		for (int j = 0; j < KEYBOARD_COLUMNS; ++j)
+		{
+			colors[i].Colors[j] = palette[0];
+		}
+	}
+	int health = FMath::RoundToInt(0.7f * KEYBOARD_COLUMNS);
+	for (int j = 0; j < health; ++j)
+	{
+		colors[0].Colors[j] = palette[1];
+	}
+	int ammo = FMath::RoundToInt(0.4f * KEYBOARD_ROWS);
+	for (int i = KEYBOARD_ROWS - ammo; i < KEYBOARD_ROWS; ++i)
+	{
+		colors[i].Colors[KEYBOARD_COLUMNS - 1] = palette[2];
+	}
+	int banner = KEYBOARD_COLUMNS - 2;
+	for (int j = 0; j < banner; ++j)
+	{
+		colors[1].Colors[j] = Lerp(palette[3], palette[4], banner > 1 ? j / (float)(banner - 1) : 0.0f);
+	}
+	for (int step = 0; step <= 6; ++step)
+	{
+		int row = FMath::RoundToInt(2 + step * 0.5f);
+		colors[row].Colors[2 + step] = palette[5];
+		colors[7 - row].Colors[2 + step] = palette[5];
+	}
+	for (int i = 0; i < KEYBOARD_ROWS; ++i)
+	{
+		for (int j = 0; j < KEYBOARD_COLUMNS; ++j)
+		{
+			float row = i - 3.5f;
+			float column = j - 15.0f;
+			if (row * row + column * column <= 4.0f)
+			{
+				colors[i].Colors[j] = palette[6];
+			}
+		}
+	}
+	const FLinearColor target = colors[KEYBOARD_ROWS - 1].Colors[0];
+	vector<int> stack;
+	stack.push_back((KEYBOARD_ROWS - 1) * KEYBOARD_COLUMNS);
+	while (!stack.empty())
+	{
+		int index = stack.back();
+		stack.pop_back();
+		int i = index / KEYBOARD_COLUMNS;
+		int j = index % KEYBOARD_COLUMNS;
+		if (i < 0 ||
+			i >= KEYBOARD_ROWS ||
+			colors[i].Colors[j] != target)
+		{
+			continue;
+		}
+		colors[i].Colors[j] = palette[7];
+		stack.push_back(index - KEYBOARD_COLUMNS);
+		stack.push_back(index + KEYBOARD_COLUMNS);
+		if (j > 0)
+		{
+			stack.push_back(index - 1);
+		}
+		if (j + 1 < KEYBOARD_COLUMNS)
+		{
+			stack.push_back(index + 1);
+		}
+	}
+}
+
+static TArray<FChromaSDKColors> MakeColors()
+{
+	TArray<FChromaSDKColors> colors;
+	for (int i = 0; i < KEYBOARD_ROWS; ++i)
+	{
+		FChromaSDKColors row;
+		row.Colors.SetNum(KEYBOARD_COLUMNS);
+		colors.Add(row);
+	}
+	return colors;
+}
+
+int main()
+{
+	const FLinearColor linearPalette[] =
+	{
+		FLinearColor(0.0f, 0.0f, 0.0f, 1.0f),
+		FLinearColor(1.0f, 0.0f, 0.0f, 1.0f),
+		FLinearColor(1.0f, 1.0f, 0.0f, 1.0f),
+		FLinearColor(0.0f, 0.0f, 1.0f, 1.0f),
+		FLinearColor(0.0f, 1.0f, 1.0f, 1.0f),
+		FLinearColor(1.0f, 1.0f, 1.0f, 1.0f),
+		FLinearColor(0.0f, 1.0f, 0.0f, 1.0f),
+		FLinearColor(0.1f, 0.1f, 0.1f, 1.0f),
+	};
+	const COLORREF packedPalette[] =
+	{
+		RGB(0, 0, 0),
+		RGB(255, 0, 0),
+		RGB(255, 255, 0),
+		RGB(0, 0, 255),
+		RGB(0, 255, 255),
+		RGB(255, 255, 255),
+		RGB(0, 255, 0),
+		RGB(25, 25, 25),
+	};
+
+	TArray<FChromaSDKColors> colors = MakeColors();
+	COLORREF packed[KEYBOARD_ROWS * KEYBOARD_COLUMNS];
+	const int iterations = 200000;
+
+	printf("keyboard HUD, %d x %d\r\n", KEYBOARD_ROWS, KEYBOARD_COLUMNS);
+
+	double nanoseconds = Bench::Measure([&]()
+	{
+		DrawHudPerCell(colors, linearPalette);
+		Bench::Keep(colors);
+	}, iterations);
+	printf("  %-38s %10.2f us/redraw\r\n", "per cell, blueprint colors (before)", nanoseconds / 1000.0);
+
+	Draw::FLinearGrid linearGrid = Draw::MakeGrid(colors);
+	nanoseconds = Bench::Measure([&]()
+	{
+		DrawHud(linearGrid, linearPalette);
+		Bench::Keep(colors);
+	}, iterations);
+	printf("  %-38s %10.2f us/redraw\r\n", "Draw, blueprint colors", nanoseconds / 1000.0);
+
+	Draw::FPackedGrid packedGrid = Draw::MakeGrid(packed, KEYBOARD_ROWS, KEYBOARD_COLUMNS);
+	nanoseconds = Bench::Measure([&]()
+	{
+		DrawHud(packedGrid, packedPalette);
+		Bench::Keep(packed);
+	}, iterations);
+	printf("  %-38s %10.2f us/redraw\r\n", "Draw, packed canvas", nanoseconds / 1000.0);
+	return 0;
+}
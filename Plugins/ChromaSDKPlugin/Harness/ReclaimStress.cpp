@@ -0,0 +1,310 @@
+// Stress test for the animation registry and the tick epoch reclaimer.
+//
+// Standalone, no engine or SDK needed. Several API threads open, play, read and
+// close animations by id while a worker thread ticks the playing list the way
+// ChromaThread does. Any double delete, use after free, resurrected animation or
+// leak fails the run.
+//
+// Build and run from this folder:
+//   g++ -std=c++14 -O1 -g -fsanitize=thread -I../Source/ChromaSDKPlugin/Public ReclaimStress.cpp -o ReclaimStress -lpthread && ./ReclaimStress
+//   g++ -std=c++14 -O1 -g -fsanitize=address -I../Source/ChromaSDKPlugin/Public ReclaimStress.cpp -o ReclaimStress -lpthread && ./ReclaimStress
+
+#include "ChromaReclaimer.h"
+#include "ChromaRegistry.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ChromaSDK;
+using namespace std;
+
+static const unsigned int ALIVE = 0xA11FEu;
+static const unsigned int DEAD = 0xDEADu;
+static const int API_THREADS = 6;
+static const int OPERATIONS = 40000;
+static const int NAME_COUNT = 16;
+
+static atomic<int> _sCreated(0);
+static atomic<int> _sDeleted(0);
+static atomic<int> _sFailures(0);
+
+static void Fail(const char* message)
+{
+	if (_sFailures++ == 0)
+	{
+		fprintf(stderr, "ReclaimStress: %s\r\n", message);
+	}
+}
+
+// stands in for AnimationBase, only the parts the lifetime rules touch
+class FakeAnimation
+{
+public:
+	explicit FakeAnimation(const string& name) :
+		_mName(name),
+		_mMagic(ALIVE),
+		_mFrame(0),
+		_mClosed(false)
+	{
+		++_sCreated;
+	}
+	~FakeAnimation()
+	{
+		if (_mMagic != ALIVE)
+		{
+			Fail("Double delete!");
+		}
+		_mMagic = DEAD;
+		++_sDeleted;
+	}
+	const string& GetName()
+	{
+		return _mName;
+	}
+	// what Update and the API getters do, touch the object
+	void Touch()
+	{
+		if (_mMagic != ALIVE)
+		{
+			Fail("Use after free!");
+		}
+		++_mFrame;
+	}
+	void Close()
+	{
+		_mClosed = true;
+	}
+	bool IsClosed()
+	{
+		return _mClosed;
+	}
+private:
+	string _mName;
+	volatile unsigned int _mMagic;
+	atomic<int> _mFrame;
+	atomic<bool> _mClosed;
+};
+
+// stands in for ChromaThread, same locks and the same closed check
+class FakeThread
+{
+public:
+	FakeThread() :
+		_mReclaimer(_mTickMutex),
+		_mRunning(true)
+	{
+	}
+	void AddAnimation(FakeAnimation* animation)
+	{
+		lock_guard<mutex> guard(_mMutex);
+		if (animation->IsClosed())
+		{
+			return;
+		}
+		if (find(_mAnimations.begin(), _mAnimations.end(), animation) == _mAnimations.end())
+		{
+			_mAnimations.push_back(animation);
+		}
+	}
+	void RemoveAnimation(FakeAnimation* animation)
+	{
+		lock_guard<mutex> guard(_mMutex);
+		auto it = find(_mAnimations.begin(), _mAnimations.end(), animation);
+		if (it != _mAnimations.end())
+		{
+			_mAnimations.erase(it);
+		}
+	}
+	void Step()
+	{
+		lock_guard<mutex> tickGuard(_mTickMutex);
+		{
+			lock_guard<mutex> guard(_mMutex);
+			for (unsigned int i = 0; i < _mAnimations.size(); ++i)
+			{
+				if (_mAnimations[i]->IsClosed())
+				{
+					Fail("Closed animation is in the playing list!");
+				}
+				_mAnimations[i]->Touch();
+			}
+			// animations that completed leave the list
+			if (_mAnimations.size() > 8)
+			{
+				_mAnimations.erase(_mAnimations.begin());
+			}
+		}
+		_mReclaimer.AdvanceEpoch();
+	}
+	void Worker()
+	{
+		while (_mRunning)
+		{
+			Step();
+			this_thread::yield();
+		}
+	}
+	void Stop()
+	{
+		_mRunning = false;
+	}
+	ChromaReclaimer<FakeAnimation>& GetReclaimer()
+	{
+		return _mReclaimer;
+	}
+private:
+	mutex _mTickMutex;
+	ChromaReclaimer<FakeAnimation> _mReclaimer;
+	mutex _mMutex;
+	vector<FakeAnimation*> _mAnimations;
+	atomic<bool> _mRunning;
+};
+
+static FakeThread* _sThread = nullptr;
+
+struct FRetireFake
+{
+	void operator()(FakeAnimation* animation) const
+	{
+		_sThread->GetReclaimer().Retire(animation);
+	}
+};
+
+typedef ChromaRegistry<FakeAnimation, FRetireFake> FRegistry;
+
+static FRegistry* _sRegistry = nullptr;
+static atomic<int> _sNextId(0);
+
+// same steps as FChromaSDKPluginModule::OpenAnimation
+static int Open(int name)
+{
+	const string path = "animation" + to_string(name) + ".chroma";
+	int id = _sRegistry->FindName(path);
+	if (id >= 0)
+	{
+		return id;
+	}
+	return _sRegistry->Register(_sNextId++, new FakeAnimation(path), path.c_str());
+}
+
+// same steps as FChromaSDKPluginModule::PlayAnimation
+static void Play(int id)
+{
+	shared_ptr<FakeAnimation> animation = _sRegistry->Find(id);
+	if (animation == nullptr)
+	{
+		return;
+	}
+	animation->Touch();
+	// the real play claims the device first, which leaves room for a close
+	this_thread::yield();
+	_sThread->AddAnimation(animation.get());
+}
+
+// same steps as FChromaSDKPluginModule::GetAnimationFrameCount and the frame edits
+static void Read(int id)
+{
+	shared_ptr<FakeAnimation> animation = _sRegistry->Find(id);
+	if (animation == nullptr)
+	{
+		return;
+	}
+	for (int i = 0; i < 8; ++i)
+	{
+		animation->Touch();
+		this_thread::yield();
+	}
+}
+
+// same steps as FChromaSDKPluginModule::CloseAnimation
+static void Close(int id)
+{
+	shared_ptr<FakeAnimation> animation = _sRegistry->Find(id);
+	if (animation == nullptr ||
+		!_sRegistry->Unregister(id))
+	{
+		return;
+	}
+	animation->Close();
+	_sThread->RemoveAnimation(animation.get());
+	animation.reset();
+	_sThread->GetReclaimer().Reclaim(false);
+}
+
+static void ApiThread(unsigned int seed)
+{
+	mt19937 random(seed);
+	for (int i = 0; i < OPERATIONS; ++i)
+	{
+		const int name = (int)(random() % NAME_COUNT);
+		// ids are handed out in order, recent ones are the likely live ones
+		const int latest = _sNextId;
+		const int id = latest > 0 ? latest - 1 - (int)(random() % min(latest, NAME_COUNT * 2)) : 0;
+		switch (random() % 4)
+		{
+		case 0:
+			Open(name);
+			break;
+		case 1:
+			Play(id);
+			break;
+		case 2:
+			Read(id);
+			break;
+		case 3:
+			Close(id);
+			break;
+		}
+	}
+}
+
+int main()
+{
+	_sThread = new FakeThread();
+	_sRegistry = new FRegistry();
+
+	thread worker(&FakeThread::Worker, _sThread);
+	vector<thread> threads;
+	for (int i = 0; i < API_THREADS; ++i)
+	{
+		threads.push_back(thread(ApiThread, 1234u + i));
+	}
+	for (unsigned int i = 0; i < threads.size(); ++i)
+	{
+		threads[i].join();
+	}
+	_sThread->Stop();
+	worker.join();
+
+	// what ChromaSDKUnInit does, close everything then wait for the reclaimer
+	shared_ptr<const FRegistry::FSnapshot> snapshot = _sRegistry->GetSnapshot();
+	vector<int> ids;
+	for (auto it = snapshot->Objects.begin(); it != snapshot->Objects.end(); ++it)
+	{
+		ids.push_back(it->first);
+	}
+	snapshot.reset();
+	for (unsigned int i = 0; i < ids.size(); ++i)
+	{
+		Close(ids[i]);
+	}
+	_sRegistry->Clear();
+	_sThread->GetReclaimer().Reclaim(true);
+
+	if (_sThread->GetReclaimer().GetRetiredCount() != 0 ||
+		_sCreated != _sDeleted)
+	{
+		Fail("Animations leaked!");
+	}
+	printf("ReclaimStress: created=%d deleted=%d failures=%d\r\n", (int)_sCreated, (int)_sDeleted, (int)_sFailures);
+
+	delete _sRegistry;
+	delete _sThread;
+	return _sFailures == 0 ? 0 : 1;
+}
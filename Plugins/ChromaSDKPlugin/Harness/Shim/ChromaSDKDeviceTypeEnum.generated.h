@@ -0,0 +1,3 @@
+#pragma once
+
+// empty, HarnessShim.h stands in for the engine
@@ -0,0 +1,120 @@
+#pragma once
+
+// Just enough of the engine and Windows headers to build the plugin's
+// standalone kernels (ChromaColor, ChromaDraw, ChromaSDKKeyMap) with GCC
+// or Clang. Force included by the harness builds, never by the plugin.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define PLATFORM_WINDOWS 1
+#define CHROMASDKPLUGIN_API
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int32_t int32;
+
+// windows types
+// 32 bit like on windows, COLORREF arrays are stored and loaded as packed 32 bit pixels
+typedef int32_t LONG;
+typedef uint32_t DWORD;
+typedef DWORD COLORREF;
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef void* HWND;
+typedef void* HMODULE;
+typedef int BOOL;
+typedef unsigned int UINT;
+struct GUID
+{
+	uint32_t Data1;
+	unsigned short Data2;
+	unsigned short Data3;
+	unsigned char Data4[8];
+};
+#define RGB(r, g, b) ((COLORREF)(((BYTE)(r) | ((WORD)((BYTE)(g)) << 8)) | (((DWORD)(BYTE)(b)) << 16)))
+#define GetRValue(rgb) ((BYTE)(rgb))
+#define GetGValue(rgb) ((BYTE)(((WORD)(rgb)) >> 8))
+#define GetBValue(rgb) ((BYTE)((rgb) >> 16))
+#define WM_APP 0x8000
+#define LOBYTE(w) ((BYTE)(((uintptr_t)(w)) & 0xff))
+#define HIBYTE(w) ((BYTE)((((uintptr_t)(w)) >> 8) & 0xff))
+
+// reflection macros
+#define UENUM(...)
+#define UMETA(...)
+#define USTRUCT(...)
+#define UPROPERTY(...)
+#define GENERATED_BODY(...)
+#define GENERATED_USTRUCT_BODY(...)
+#define TEXT(x) L##x
+#define UE_LOG(...) do {} while (0)
+
+class FString
+{
+public:
+	FString() {}
+	FString(const wchar_t* value) : _mValue(value) {}
+private:
+	std::wstring _mValue;
+};
+
+template<typename T>
+class TArray
+{
+public:
+	int Num() const { return (int)_mValues.size(); }
+	T& operator[](int index) { return _mValues[index]; }
+	const T& operator[](int index) const { return _mValues[index]; }
+	int Add(const T& value) { _mValues.push_back(value); return (int)_mValues.size() - 1; }
+	void Empty() { _mValues.clear(); }
+	void Reset() { _mValues.clear(); }
+	void SetNum(int count) { _mValues.resize(count); }
+	T* GetData() { return _mValues.data(); }
+	const T* GetData() const { return _mValues.data(); }
+private:
+	std::vector<T> _mValues;
+};
+
+struct FLinearColor
+{
+	float R;
+	float G;
+	float B;
+	float A;
+	FLinearColor() : R(0.0f), G(0.0f), B(0.0f), A(0.0f) {}
+	FLinearColor(float r, float g, float b, float a = 1.0f) : R(r), G(g), B(b), A(a) {}
+	bool operator==(const FLinearColor& other) const { return R == other.R && G == other.G && B == other.B && A == other.A; }
+	bool operator!=(const FLinearColor& other) const { return !(*this == other); }
+};
+
+struct FMath
+{
+	template<typename T> static T Min(T a, T b) { return a < b ? a : b; }
+	template<typename T> static T Max(T a, T b) { return a > b ? a : b; }
+	template<typename T> static T Clamp(T value, T low, T high) { return value < low ? low : (value > high ? high : value); }
+	template<typename T> static T Abs(T value) { return value < 0 ? -value : value; }
+	static float Sqrt(float value) { return sqrtf(value); }
+	static int CeilToInt(float value) { return (int)ceilf(value); }
+	static int FloorToInt(float value) { return (int)floorf(value); }
+	static int RoundToInt(float value) { return (int)floorf(value + 0.5f); }
+};
+
+class IModuleInterface
+{
+public:
+	virtual ~IModuleInterface() {}
+	virtual void StartupModule() {}
+	virtual void ShutdownModule() {}
+};
+
+struct FModuleManager
+{
+	template<typename T> static T& GetModuleChecked(const char* /*name*/) { static T module; return module; }
+};
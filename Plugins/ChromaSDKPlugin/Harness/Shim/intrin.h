@@ -0,0 +1,28 @@
+#pragma once
+
+// MSVC cpuid intrinsics on top of the GCC and Clang ones
+#include <cpuid.h>
+
+// newer cpuid.h has its own __cpuidex, keep ours apart
+#undef __cpuid
+#define __cpuidex HarnessCpuidEx
+
+inline void __cpuid(int* info, int leaf)
+{
+	unsigned int a, b, c, d;
+	__cpuid_count(leaf, 0, a, b, c, d);
+	info[0] = (int)a;
+	info[1] = (int)b;
+	info[2] = (int)c;
+	info[3] = (int)d;
+}
+
+inline void HarnessCpuidEx(int* info, int leaf, int subleaf)
+{
+	unsigned int a, b, c, d;
+	__cpuid_count(leaf, subleaf, a, b, c, d);
+	info[0] = (int)a;
+	info[1] = (int)b;
+	info[2] = (int)c;
+	info[3] = (int)d;
+}
@@ -0,0 +1,238 @@
+// Determinism check for the virtual clock, the scripted timeline and the
+// capture tracks the offline renderer is built from.
+//
+// Standalone, no engine or SDK needed. A stand-in pipeline plays a looping
+// animation that a timeline starts, speeds up and stops, and a capture track
+// records what it shows. Two renders of the same timeline must match bit for
+// bit, and the step clock must turn a virtual clock into exact steps. Prints
+// how long a ten minute scenario takes to render.
+//
+// Build and run from this folder:
+//   g++ -std=c++14 -O2 -I../Source/ChromaSDKPlugin/Public TimelineCheck.cpp -o TimelineCheck && ./TimelineCheck
+
+#include "Bench.h"
+#include "ChromaCaptureTrack.h"
+#include "ChromaClock.h"
+#include "ChromaTimeline.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace ChromaSDK;
+using namespace std;
+
+static const int SIZE = 6 * 22;
+static const int FRAME_COUNT = 8;
+static const float FRAME_DURATION = 0.1f;
+
+static int _sFailures = 0;
+
+static void Fail(const char* message)
+{
+	if (_sFailures++ == 0)
+	{
+		fprintf(stderr, "TimelineCheck: %s\r\n", message);
+	}
+}
+
+// stands in for an animation on the worker, Update advances by the scaled step
+class FakeAnimation
+{
+public:
+	FakeAnimation() :
+		_mPlaying(false),
+		_mTimeScale(1.0f),
+		_mTime(0.0f),
+		_mFrame(0)
+	{
+	}
+	void Play()
+	{
+		_mPlaying = true;
+		_mTime = 0.0f;
+		_mFrame = 0;
+	}
+	void Stop()
+	{
+		_mPlaying = false;
+	}
+	void SetTimeScale(float timeScale)
+	{
+		_mTimeScale = timeScale;
+	}
+	void Update(float deltaTime)
+	{
+		if (!_mPlaying)
+		{
+			return;
+		}
+		_mTime += deltaTime * _mTimeScale;
+		while (_mTime >= FRAME_DURATION)
+		{
+			_mTime -= FRAME_DURATION;
+			_mFrame = (_mFrame + 1) % FRAME_COUNT;
+		}
+	}
+	// what the device shows, black while stopped
+	void Show(unsigned int* colors)
+	{
+		for (int i = 0; i < SIZE; ++i)
+		{
+			colors[i] = _mPlaying ? (unsigned int)(_mFrame * 0x10203 + i + 1) : 0;
+		}
+	}
+private:
+	bool _mPlaying;
+	float _mTimeScale;
+	float _mTime;
+	int _mFrame;
+};
+
+// same steps as ChromaOfflineRenderer::Render with the worker tick and the recorder
+static void Render(float duration, ChromaCaptureTrack<unsigned int>& track)
+{
+	FakeAnimation animation;
+	ChromaTimeline timeline(1.0f / 60.0f);
+	timeline.AddEvent(0.5f, [&]() { animation.Play(); });
+	timeline.AddEvent(duration * 0.25f, [&]() { animation.SetTimeScale(2.5f); });
+	timeline.AddEvent(duration * 0.5f, [&]() { animation.SetTimeScale(0.5f); });
+	timeline.AddEvent(duration * 0.75f, [&]() { animation.Stop(); });
+	timeline.AddEvent(duration * 0.75f, [&]() { animation.Play(); });
+
+	unsigned int colors[SIZE];
+	float capturedTime = 0.0f;
+	bool shown = false;
+	timeline.Run(duration, [&](float deltaTime)
+	{
+		animation.Update(deltaTime);
+		animation.Show(colors);
+		// the recorder only captures a device once something was shown on it
+		shown = shown || colors[0] != 0;
+		if (shown)
+		{
+			track.Capture(colors, SIZE, deltaTime, capturedTime);
+		}
+		capturedTime += deltaTime;
+	});
+}
+
+static bool Matches(const ChromaCaptureTrack<unsigned int>& a, const ChromaCaptureTrack<unsigned int>& b)
+{
+	if (a.GetFrameCount() != b.GetFrameCount())
+	{
+		return false;
+	}
+	for (unsigned int i = 0; i < a.GetFrameCount(); ++i)
+	{
+		float durationA = a.GetDuration(i);
+		float durationB = b.GetDuration(i);
+		if (memcmp(&durationA, &durationB, sizeof(float)) != 0 ||
+			memcmp(a.GetColors(i, SIZE), b.GetColors(i, SIZE), SIZE * sizeof(unsigned int)) != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static void CheckTimeline()
+{
+	ChromaCaptureTrack<unsigned int> first;
+	ChromaCaptureTrack<unsigned int> second;
+	Render(60.0f, first);
+	Render(60.0f, second);
+	if (!Matches(first, second))
+	{
+		Fail("Renders of the same timeline differ!");
+	}
+	if (first.GetFrameCount() < 2 ||
+		first.GetDuration(0) < 0.49f ||
+		first.GetDuration(0) > 0.51f)
+	{
+		Fail("Track does not open with the black lead in!");
+	}
+	for (unsigned int i = 1; i < first.GetFrameCount(); ++i)
+	{
+		if (memcmp(first.GetColors(i - 1, SIZE), first.GetColors(i, SIZE), SIZE * sizeof(unsigned int)) == 0)
+		{
+			Fail("Repeated colors were not merged!");
+			break;
+		}
+	}
+	float total = 0.0f;
+	for (unsigned int i = 0; i < first.GetFrameCount(); ++i)
+	{
+		total += first.GetDuration(i);
+	}
+	if (total < 59.9f ||
+		total > 60.1f)
+	{
+		Fail("Track does not cover the duration!");
+	}
+}
+
+static double _sVirtualTime = 0.0;
+static double _sOtherTime = 100.0;
+
+static double GetVirtualTime()
+{
+	return _sVirtualTime;
+}
+
+static double GetOtherTime()
+{
+	return _sOtherTime;
+}
+
+static void CheckClock()
+{
+	ChromaStepClock clock;
+	clock.SetClock(GetVirtualTime);
+	clock.Reset();
+	for (int i = 1; i <= 100; ++i)
+	{
+		_sVirtualTime = i * 0.25;
+		if (clock.Step() != 0.25f)
+		{
+			Fail("Virtual clock step is not exact!");
+			break;
+		}
+	}
+	if (clock.Step() != 0.0f)
+	{
+		Fail("Stopped virtual clock moved!");
+	}
+	// a new clock restarts the timeline instead of jumping
+	clock.SetClock(GetOtherTime);
+	if (clock.Step() != 0.0f)
+	{
+		Fail("Clock swap did not restart the timeline!");
+	}
+	_sOtherTime += 0.5;
+	if (clock.Step() != 0.5f)
+	{
+		Fail("Swapped clock step is not exact!");
+	}
+	// back to real time
+	clock.SetClock(nullptr);
+	clock.Step();
+	if (clock.Step() < 0.0f)
+	{
+		Fail("Real time clock went backwards!");
+	}
+}
+
+int main()
+{
+	CheckClock();
+	CheckTimeline();
+
+	double nanoseconds = Bench::Measure([&]()
+	{
+		ChromaCaptureTrack<unsigned int> track;
+		Render(600.0f, track);
+		Bench::Keep(track);
+	}, 5, 3);
+	printf("TimelineCheck: ten minutes at 60 steps/s render in %.2f ms\r\n", nanoseconds / 1000000.0);
+	printf("TimelineCheck: failures=%d\r\n", _sFailures);
+	return _sFailures == 0 ? 0 : 1;
+}
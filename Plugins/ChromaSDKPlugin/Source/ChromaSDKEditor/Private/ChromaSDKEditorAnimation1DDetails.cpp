@@ -6,6 +6,7 @@
 
 #if WITH_EDITOR
 #include "ChromaSDKEditorButton1D.h"
+#include "ChromaColor.h"
 #include "ChromaSDKPluginAnimation1DObject.h"
 #include "ChromaSDKPluginBPLibrary.h"
 
@@ -183,25 +184,16 @@ void FChromaSDKEditorAnimation1DDetails::ReadChromaFile(const FString& path)
 
 									// colors
 									expectedSize = sizeof(int);
-									for (int i = 0; i < maxLeds; ++i)
+									COLORREF colors[ChromaSDK::Mousepad::MAX_LEDS];
+									read = fread(colors, expectedSize, maxLeds, stream);
+									if (read != maxLeds)
 									{
-										int color = 0;
-										read = fread(&color, expectedSize, 1, stream);
-										if (read != expectedRead)
-										{
-											fprintf(stderr, "OpenAnimation: Error detected reading color!\r\n");
-											std::fclose(stream);
-											return;
-										}
-										else
-										{
-											float red = GetRValue(color) / 255.0f;
-											float green = GetGValue(color) / 255.0f;
-											float blue = GetBValue(color) / 255.0f;
-											FLinearColor linearColor = FLinearColor(red, green, blue, 1.0f);
-											frame.Colors.Add(linearColor);
-										}
+										fprintf(stderr, "OpenAnimation: Error detected reading color!\r\n");
+										std::fclose(stream);
+										return;
 									}
+									frame.Colors.SetNumUninitialized(maxLeds);
+									ChromaSDK::Color::ToLinearColor(colors, frame.Colors.GetData(), maxLeds);
 									frames.Add(frame);
 								}
 							}
@@ -280,17 +272,11 @@ void FChromaSDKEditorAnimation1DDetails::WriteChromaFile(const FString& path)
 
 				//colors
 				FChromaSDKColorFrame1D& frame = frames[index];
-				for (int i = 0; i < frame.Colors.Num(); ++i)
-				{
-					//color
-					FLinearColor& color = frame.Colors[i];
-					int red = color.R * 255;
-					int green = color.G * 255;
-					int blue = color.B * 255;
-					int bgrInt = RGB(red, green, blue);
-					expectedSize = sizeof(int);
-					fwrite(&bgrInt, expectedSize, 1, stream);
-				}
+				int count = FMath::Min(frame.Colors.Num(), (int)ChromaSDK::Mousepad::MAX_LEDS);
+				COLORREF colors[ChromaSDK::Mousepad::MAX_LEDS];
+				ChromaSDK::Color::ToBGR(frame.Colors.GetData(), colors, count);
+				expectedSize = sizeof(int);
+				fwrite(colors, expectedSize, count, stream);
 			}
 
 			fflush(stream);
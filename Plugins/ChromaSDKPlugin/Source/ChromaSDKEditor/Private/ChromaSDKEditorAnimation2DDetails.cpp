@@ -6,6 +6,7 @@
 
 #if WITH_EDITOR
 #include "ChromaSDKEditorButton2D.h"
+#include "ChromaColor.h"
 #include "ChromaSDKPluginAnimation2DObject.h"
 #include "ChromaSDKPluginBPLibrary.h"
 
@@ -223,28 +224,19 @@ void FChromaSDKEditorAnimation2DDetails::ReadChromaFile(const FString& path)
 
 									// colors
 									expectedSize = sizeof(int);
+									COLORREF colors[ChromaSDK::Keyboard::MAX_ROW * ChromaSDK::Keyboard::MAX_COLUMN];
+									read = fread(colors, expectedSize, maxRow * maxColumn, stream);
+									if (read != maxRow * maxColumn)
+									{
+										fprintf(stderr, "OpenAnimation: Error detected reading color!\r\n");
+										std::fclose(stream);
+										return;
+									}
 									for (int i = 0; i < maxRow; ++i)
 									{
 										FChromaSDKColors row = FChromaSDKColors();
-										for (int j = 0; j < maxColumn; ++j)
-										{
-											int color = 0;
-											read = fread(&color, expectedSize, 1, stream);
-											if (read != expectedRead)
-											{
-												fprintf(stderr, "OpenAnimation: Error detected reading color!\r\n");
-												std::fclose(stream);
-												return;
-											}
-											else
-											{
-												float red = GetRValue(color) / 255.0f;
-												float green = GetGValue(color) / 255.0f;
-												float blue = GetBValue(color) / 255.0f;
-												FLinearColor linearColor = FLinearColor(red, green, blue, 1.0f);
-												row.Colors.Add(linearColor);
-											}
-										}
+										row.Colors.SetNumUninitialized(maxColumn);
+										ChromaSDK::Color::ToLinearColor(colors + i * maxColumn, row.Colors.GetData(), maxColumn);
 										frame.Colors.Add(row);
 									}
 									frames.Add(frame);
@@ -330,17 +322,11 @@ void FChromaSDKEditorAnimation2DDetails::WriteChromaFile(const FString& path)
 				{
 					FChromaSDKColors& row = colors[i];
 					TArray<FLinearColor>& rowColors = colors[i].Colors;
-					for (int j = 0; j < rowColors.Num(); ++j)
-					{
-						//color
-						FLinearColor& color = rowColors[j];
-						int red = color.R * 255;
-						int green = color.G * 255;
-						int blue = color.B * 255;
-						int bgrInt = RGB(red, green, blue);
-						expectedSize = sizeof(int);
-						fwrite(&bgrInt, expectedSize, 1, stream);
-					}
+					int count = FMath::Min(rowColors.Num(), (int)ChromaSDK::Keyboard::MAX_COLUMN);
+					COLORREF bgrColors[ChromaSDK::Keyboard::MAX_COLUMN];
+					ChromaSDK::Color::ToBGR(rowColors.GetData(), bgrColors, count);
+					expectedSize = sizeof(int);
+					fwrite(bgrColors, expectedSize, count, stream);
 				}
 			}
 
@@ -1,8 +1,11 @@
 #//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
 #include "Animation1D.h"
 #include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaColor.h"
+#include "ChromaDraw.h"
 #include "ChromaSDKPluginBPLibrary.h"
 #include "ChromaThread.h"
+#include <algorithm>
 
 #if PLATFORM_WINDOWS
 
@@ -10,6 +13,7 @@
 
 typedef unsigned char byte;
 #define ANIMATION_VERSION 1
+#define ANIMATION_VERSION_PALETTE 2
 
 using namespace ChromaSDK;
 using namespace std;
@@ -21,12 +25,14 @@ Animation1D::Animation1D()
 	Reset();
 }
 
+Animation1D::~Animation1D()
+{
+	Unload();
+}
+
 void Animation1D::Reset()
 {
-	_mFrames.clear();
-	FChromaSDKColorFrame1D frame = FChromaSDKColorFrame1D();
-	frame.Colors = UChromaSDKPluginBPLibrary::CreateColors1D(_mDevice);
-	_mFrames.push_back(frame);
+	_mStorage = make_shared<FChromaFrames1D>();
 
 	_mIsPlaying = false;
 	_mIsLoaded = false;
@@ -64,49 +70,181 @@ int Animation1D::GetDeviceId()
 	return (int)GetDevice();
 }
 
-vector<FChromaSDKColorFrame1D>& Animation1D::GetFrames()
+vector<FChromaFrame1D>& Animation1D::GetFrames()
+{
+	UnindexFrames();
+	return _mStorage->Frames;
+}
+
+int Animation1D::GetColorCount()
+{
+	return FChromaSDKPluginModule::GetMaxLeds(_mDevice);
+}
+
+const COLORREF* Animation1D::GetFrameColors(int index, COLORREF* scratch)
+{
+	if (_mStorage->Indexed)
+	{
+		Palette::Decode(_mStorage->Palette, _mStorage->IndexedFrames[index], scratch, GetColorCount());
+		return scratch;
+	}
+	return _mStorage->Frames[index].Colors;
+}
+
+bool Animation1D::IsIndexed()
+{
+	return _mStorage->Indexed;
+}
+
+bool Animation1D::IndexFrames()
+{
+	if (_mStorage->Indexed)
+	{
+		return true;
+	}
+	DetachFrames();
+	if (!Palette::Encode(_mStorage->Frames, GetColorCount(), _mStorage->Palette, _mStorage->IndexedFrames))
+	{
+		return false;
+	}
+	_mStorage->Frames.clear();
+	_mStorage->Indexed = true;
+	return true;
+}
+
+void Animation1D::SetIndexedFrames(vector<COLORREF>& palette, vector<FChromaIndexedFrame1D>& indexedFrames)
+{
+	DetachFrames();
+	_mStorage->Palette.swap(palette);
+	_mStorage->IndexedFrames.swap(indexedFrames);
+	_mStorage->Frames.clear();
+	_mStorage->Indexed = true;
+}
+
+void Animation1D::DetachFrames()
+{
+	if (_mStorage.use_count() > 1)
+	{
+		_mStorage = make_shared<FChromaFrames1D>(*_mStorage);
+	}
+}
+
+void Animation1D::ShareFrames(Animation1D* source)
 {
-	return _mFrames;
+	AnimationPairLock guard(this, source);
+	_mDevice = source->_mDevice;
+	_mStorage = source->_mStorage;
+	ResetPlayhead();
+	MarkFramesChanged(0, GetFrameCount());
+}
+
+void Animation1D::UnindexFrames()
+{
+	if (!_mStorage->Indexed)
+	{
+		DetachFrames();
+		return;
+	}
+	//decode into new storage and swap it in, the indexed frames stay intact until the swap
+	shared_ptr<FChromaFrames1D> decoded = make_shared<FChromaFrames1D>();
+	const int count = GetColorCount();
+	decoded->Frames.resize(_mStorage->IndexedFrames.size());
+	for (unsigned int index = 0; index < _mStorage->IndexedFrames.size(); ++index)
+	{
+		decoded->Frames[index].Duration = _mStorage->IndexedFrames[index].Duration;
+		Palette::Decode(_mStorage->Palette, _mStorage->IndexedFrames[index], decoded->Frames[index].Colors, count);
+	}
+	_mStorage = decoded;
+}
+
+void Animation1D::ReplaceColor(COLORREF color, COLORREF newColor)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	DetachFrames();
+	bool replaced = false;
+	if (_mStorage->Indexed)
+	{
+		for (unsigned int i = 0; i < _mStorage->Palette.size(); ++i)
+		{
+			if (_mStorage->Palette[i] == color)
+			{
+				_mStorage->Palette[i] = newColor;
+				replaced = true;
+			}
+		}
+	}
+	else
+	{
+		const int count = GetColorCount();
+		for (unsigned int index = 0; index < _mStorage->Frames.size(); ++index)
+		{
+			COLORREF* colors = _mStorage->Frames[index].Colors;
+			for (int i = 0; i < count; ++i)
+			{
+				if (colors[i] == color)
+				{
+					colors[i] = newColor;
+					replaced = true;
+				}
+			}
+		}
+	}
+	if (replaced)
+	{
+		MarkFramesChanged(0, GetFrameCount());
+	}
 }
 
 int Animation1D::GetFrameCount()
 {
-	return _mFrames.size();
+	return _mStorage->Indexed ? _mStorage->IndexedFrames.size() : _mStorage->Frames.size();
 }
 
 float Animation1D::GetDuration(unsigned int index)
 {
-	if (index < _mFrames.size())
+	if (_mStorage->Indexed)
+	{
+		return index < _mStorage->IndexedFrames.size() ? _mStorage->IndexedFrames[index].Duration : 0.0f;
+	}
+	if (index < _mStorage->Frames.size())
 	{
-		FChromaSDKColorFrame1D& frame = _mFrames[index];
+		FChromaFrame1D& frame = _mStorage->Frames[index];
 		return frame.Duration;
 	}
 	return 0.0f;
 }
 
+FChromaSDKEffectResult Animation1D::CreateEffect(int index)
+{
+	FChromaSDKEffectResult effect = FChromaSDKEffectResult();
+	COLORREF colors[MAX_COLORS_1D];
+	effect.Result = FChromaSDKPluginModule::Get().CreateEffectCustom1D(_mDevice, GetFrameColors(index, colors), &effect.EffectId.Data);
+	return effect;
+}
+
 void Animation1D::Load()
 {
-	if (_mIsLoaded)
+	//rebuild the effects under the lock the worker shows them under
+	lock_guard<mutex> guard(_mFrameMutex);
+
+	//incremental, frames that have effects and are unchanged are skipped
+	if (_mIsLoaded &&
+		!_mHasChanges &&
+		_mEffects.size() == GetFrameCount())
 	{
 		return;
 	}
 
-	for (unsigned int i = 0; i < _mFrames.size(); ++i)
-	{
-		FChromaSDKColorFrame1D& frame = _mFrames[i];
-		FChromaSDKEffectResult effect = UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom1D(_mDevice, frame.Colors);
-		if (effect.Result != 0)
-		{
-			fprintf(stderr, "Load: Failed to create effect!\r\n");
-		}
-		_mEffects.push_back(effect);
-	}
+	SyncEffects();
 
 	_mIsLoaded = true;
 }
 
 void Animation1D::Unload()
 {
+	//the worker reads the effects under the same lock
+	lock_guard<mutex> guard(_mFrameMutex);
+
 	if (!_mIsLoaded)
 	{
 		return;
@@ -127,20 +265,24 @@ void Animation1D::Unload()
 
 void Animation1D::Play(bool loop)
 {
-	if (!_mIsLoaded)
+	Start(loop);
+
+	if (ChromaThread::Instance())
 	{
-		Load();
+		ChromaThread::Instance()->AddAnimation(this);
 	}
+}
+
+void Animation1D::Start(bool loop)
+{
+	//creates missing effects and picks up edits made while stopped
+	Load();
 
 	_mTime = 0.0f;
+	_mOvershoot = 0.0f;
 	_mCurrentFrame = -1;
 	_mIsPlaying = true;
 	_mLoop = loop;
-
-	if (ChromaThread::Instance())
-	{
-		ChromaThread::Instance()->AddAnimation(this);
-	}
 }
 
 void Animation1D::Stop()
@@ -160,67 +302,69 @@ void Animation1D::Update(float deltaTime)
 		return;
 	}
 
+	//edits replace the frame storage, hold the lock for the whole step
+	lock_guard<mutex> guard(_mFrameMutex);
+
+	//apply edits made since the last update
+	PublishChanges();
+
 	if (_mCurrentFrame == -1)
 	{
 		_mCurrentFrame = 0;
-		if (_mCurrentFrame < _mEffects.size())
-		{
-			FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-			int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-			if (result != 0)
-			{
-				fprintf(stderr, "Play: Failed to set effect!\r\n");
-			}
-		}
+		ShowCurrentFrame(true);
+		return;
 	}
-	else
+
+	//carry the overshoot into the next frame so the playhead follows the elapsed time,
+	//animations started on the same tick stay on the same frame boundaries
+	_mTime += deltaTime;
+	const int frameCount = _mEffects.size();
+	int steps = 0;
+	float nextTime = GetDuration(_mCurrentFrame);
+	while (nextTime < _mTime)
 	{
-		_mTime += deltaTime;
-		float nextTime = GetDuration(_mCurrentFrame);
-		if (nextTime < _mTime)
+		_mTime -= nextTime;
+		++_mCurrentFrame;
+		++steps;
+		if (_mCurrentFrame >= frameCount)
 		{
-			_mTime = 0.0f;
-			++_mCurrentFrame;
-			if (_mCurrentFrame < _mEffects.size())
+			if (_mLoop)
 			{
-				FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-				int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-				if (result != 0)
-				{
-					fprintf(stderr, "Update: Failed to set effect!\r\n");
-				}
+				_mCurrentFrame = 0;
+				PostEvent(EChromaSDKAnimationEventEnum::AE_Loop);
 			}
 			else
 			{
-				if (_mLoop)
-				{
-					_mTime = 0.0f;
-					_mCurrentFrame = -1;
-				}
-				else
-				{
-					//fprintf(stdout, "Update: Animation Complete.\r\n");
-					_mIsPlaying = false;
-					_mTime = 0.0f;
-					_mCurrentFrame = 0;
-				}
+				//fprintf(stdout, "Update: Animation Complete.\r\n");
+				_mIsPlaying = false;
+				_mOvershoot = _mTime;
+				_mTime = 0.0f;
+				_mCurrentFrame = 0;
+				PostEvent(EChromaSDKAnimationEventEnum::AE_Complete);
+				return;
 			}
 		}
+		if (steps > frameCount)
+		{
+			//zero length frames, drop the rest of the step
+			_mTime = 0.0f;
+			break;
+		}
+		nextTime = GetDuration(_mCurrentFrame);
+	}
+	if (steps > 0)
+	{
+		//frames identical to the previous frame leave the device as is, unless frames were skipped
+		ShowCurrentFrame(steps > 1);
 	}
 }
 
 void Animation1D::ResetFrames()
 {
+	lock_guard<mutex> guard(_mFrameMutex);
 	_mCurrentFrame = 0;
-	while (_mFrames.size() > 0)
-	{
-		auto it = _mFrames.begin();
-		_mFrames.erase(it);
-	}
-	FChromaSDKColorFrame1D frame = FChromaSDKColorFrame1D();
-	frame.Colors = UChromaSDKPluginBPLibrary::CreateColors1D(_mDevice);
-	frame.Duration = 1;
-	_mFrames.push_back(frame);
+	_mStorage = make_shared<FChromaFrames1D>();
+	MarkFrameChanged(0);
 }
 
 int Animation1D::Save(const char* path)
@@ -235,88 +379,262 @@ int Animation1D::Save(const char* path)
 	else if (0 == result &&
 		stream)
 	{
-		long write = 0;
-		long expectedWrite = 1;
-		long expectedSize = 0;
+		result = Write(stream);
+		fflush(stream);
+		std::fclose(stream);
+		return result;
+	}
+
+	return -1;
+}
+
+int Animation1D::Write(FILE* stream)
+{
+	//playing animations can be edited, save a consistent copy of the frames
+	lock_guard<mutex> guard(_mFrameMutex);
+
+	long write = 0;
+	long expectedWrite = 1;
+	long expectedSize = 0;
+
+	int version = _mStorage->Indexed ? ANIMATION_VERSION_PALETTE : ANIMATION_VERSION;
+	expectedSize = sizeof(int);
+	write = fwrite(&version, expectedSize, 1, stream);
+	if (expectedWrite != write)
+	{
+		fprintf(stderr, "Save: Failed to write version!\r\n");
+		return -1;
+	}
 
-		int version = ANIMATION_VERSION;
+	//device type
+	byte deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_1D;
+	expectedSize = sizeof(byte);
+	fwrite(&deviceType, expectedSize, 1, stream);
+
+	switch ((EChromaSDKDeviceTypeEnum)deviceType)
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 1D\r\n"));
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 2D\r\n"));
+		break;
+	}
+
+	//device
+	byte device = (byte)_mDevice;
+	fwrite(&device, expectedSize, 1, stream);
+
+	switch ((EChromaSDKDevice1DEnum)device)
+	{
+	case EChromaSDKDevice1DEnum::DE_ChromaLink:
+		UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_ChromaLink\r\n"));
+		break;
+	case EChromaSDKDevice1DEnum::DE_Headset:
+		UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Headset\r\n"));
+		break;
+	case EChromaSDKDevice1DEnum::DE_Mousepad:
+		UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Mousepad\r\n"));
+		break;
+	}
+
+	//frame count
+	unsigned int frameCount = GetFrameCount();
+	expectedSize = sizeof(unsigned int);
+	fwrite(&frameCount, expectedSize, 1, stream);
+
+	UE_LOG(LogTemp, Log, TEXT("Save: FrameCount: %d\r\n"), frameCount);
+
+	//palette
+	if (_mStorage->Indexed)
+	{
+		int paletteSize = _mStorage->Palette.size();
 		expectedSize = sizeof(int);
-		write = fwrite(&version, expectedSize, 1, stream);
-		if (expectedWrite != write)
-		{
-			fprintf(stderr, "Save: Failed to write version!\r\n");
-			std::fclose(stream);
-			return -1;
-		}
+		fwrite(&paletteSize, expectedSize, 1, stream);
+		fwrite(_mStorage->Palette.data(), expectedSize, paletteSize, stream);
+	}
 
-		//device type
-		byte deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_1D;
-		expectedSize = sizeof(byte);
-		fwrite(&deviceType, expectedSize, 1, stream);
+	//frames
+	for (unsigned int index = 0; index < frameCount; ++index)
+	{
+		//duration
+		float duration = GetDuration(index);
+		expectedSize = sizeof(float);
+		fwrite(&duration, expectedSize, 1, stream);
 
-		switch ((EChromaSDKDeviceTypeEnum)deviceType)
+		//colors
+		if (_mStorage->Indexed)
 		{
-		case EChromaSDKDeviceTypeEnum::DE_1D:
-			UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 1D\r\n"));
-			break;
-		case EChromaSDKDeviceTypeEnum::DE_2D:
-			UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 2D\r\n"));
-			break;
+			FChromaIndexedFrame1D& frame = _mStorage->IndexedFrames[index];
+			expectedSize = sizeof(uint8);
+			fwrite(frame.Indices, expectedSize, GetColorCount(), stream);
 		}
-
-		//device
-		byte device = (byte)_mDevice;
-		fwrite(&device, expectedSize, 1, stream);
-
-		switch ((EChromaSDKDevice1DEnum)device)
+		else if (index < _mStorage->Frames.size())
 		{
-		case EChromaSDKDevice1DEnum::DE_ChromaLink:
-			UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_ChromaLink\r\n"));
-			break;
-		case EChromaSDKDevice1DEnum::DE_Headset:
-			UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Headset\r\n"));
-			break;
-		case EChromaSDKDevice1DEnum::DE_Mousepad:
-			UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Mousepad\r\n"));
-			break;
+			FChromaFrame1D& frame = _mStorage->Frames[index];
+			expectedSize = sizeof(int);
+			fwrite(frame.Colors, expectedSize, GetColorCount(), stream);
 		}
+	}
 
-		//frame count
-		unsigned int frameCount = GetFrameCount();
-		expectedSize = sizeof(unsigned int);
-		fwrite(&frameCount, expectedSize, 1, stream);
+	return 0;
+}
 
-		UE_LOG(LogTemp, Log, TEXT("Save: FrameCount: %d\r\n"), frameCount);
+void Animation1D::FillFrames(int startFrame, int endFrame, COLORREF color)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	UnindexFrames();
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	const int count = GetColorCount();
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		Draw::FillSpan(_mStorage->Frames[index].Colors, count, color);
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		//frames
-		for (unsigned int index = 0; index < frameCount; ++index)
-		{
-			//duration
-			float duration = GetDuration(index);
-			expectedSize = sizeof(float);
-			fwrite(&duration, expectedSize, 1, stream);
+void Animation1D::CopyRegion(Animation1D* source, int startFrame, int endFrame, int startLed, int leds)
+{
+	AnimationPairLock guard(this, source);
+	if (nullptr == source ||
+		source->GetDevice() != _mDevice)
+	{
+		return;
+	}
+	const int sourceFrameCount = source->GetFrameCount();
+	if (sourceFrameCount == 0 ||
+		!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	UnindexFrames();
+	COLORREF scratch[MAX_COLORS_1D];
+	int endLed = FMath::Min(startLed + leds, GetColorCount());
+	startLed = FMath::Max(startLed, 0);
+	if (startLed >= endLed)
+	{
+		return;
+	}
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		const COLORREF* sourceColors = source->GetFrameColors(index % sourceFrameCount, scratch);
+		memcpy(_mStorage->Frames[index].Colors + startLed, sourceColors + startLed, (endLed - startLed) * sizeof(COLORREF));
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-			//colors
-			if (index < _mFrames.size())
-			{
-				FChromaSDKColorFrame1D& frame = _mFrames[index];
-				for (int i = 0; i < frame.Colors.Num(); ++i)
-				{
-					//color
-					int color = FChromaSDKPluginModule::ToBGR(frame.Colors[i]);
-					expectedSize = sizeof(int);
-					fwrite(&color, expectedSize, 1, stream);
-				}
-			}
+void Animation1D::CopyNonZeroFrames(Animation1D* source, int startFrame, int endFrame)
+{
+	AnimationPairLock guard(this, source);
+	if (nullptr == source ||
+		source->GetDevice() != _mDevice)
+	{
+		return;
+	}
+	const int sourceFrameCount = source->GetFrameCount();
+	if (sourceFrameCount == 0 ||
+		!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	UnindexFrames();
+	COLORREF scratch[MAX_COLORS_1D];
+	const int count = GetColorCount();
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		Color::CopyNonZero(source->GetFrameColors(index % sourceFrameCount, scratch), _mStorage->Frames[index].Colors, count);
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
+
+void Animation1D::MultiplyFrames(int startFrame, int endFrame, float intensity)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	UnindexFrames();
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	const int count = GetColorCount();
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		Color::Multiply(_mStorage->Frames[index].Colors, count, intensity);
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
+
+void Animation1D::ShiftFrames(int startFrame, int endFrame, int offset)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	UnindexFrames();
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	const int count = GetColorCount();
+	const int startLed = FMath::Clamp(offset, 0, count);
+	const int endLed = FMath::Clamp(count + offset, 0, count);
+	COLORREF shifted[MAX_COLORS_1D];
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		COLORREF* colors = _mStorage->Frames[index].Colors;
+		memset(shifted, 0, sizeof(shifted));
+		if (startLed < endLed)
+		{
+			memcpy(shifted + startLed, colors + startLed - offset, (endLed - startLed) * sizeof(COLORREF));
 		}
+		memcpy(colors, shifted, count * sizeof(COLORREF));
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		fflush(stream);
-		std::fclose(stream);
+void Animation1D::ReverseFrames(int startFrame, int endFrame)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	UnindexFrames();
+	ResetPlayhead();
+	reverse(_mStorage->Frames.begin() + startFrame, _mStorage->Frames.begin() + endFrame);
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		return 0;
+void Animation1D::DuplicateFrames(int startFrame, int endFrame)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
 	}
+	UnindexFrames();
+	ResetPlayhead();
+	vector<FChromaFrame1D> duplicates(_mStorage->Frames.begin() + startFrame, _mStorage->Frames.begin() + endFrame);
+	_mStorage->Frames.insert(_mStorage->Frames.begin() + endFrame, duplicates.begin(), duplicates.end());
+	//frames after the range moved
+	MarkFramesChanged(endFrame, _mStorage->Frames.size());
+}
 
-	return -1;
+void Animation1D::TrimFrames(int startFrame, int endFrame)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	UnindexFrames();
+	ResetPlayhead();
+	_mStorage->Frames.erase(_mStorage->Frames.begin() + endFrame, _mStorage->Frames.end());
+	_mStorage->Frames.erase(_mStorage->Frames.begin(), _mStorage->Frames.begin() + startFrame);
+	//the remaining frames moved to the front, the extra effects are released on load
+	if (startFrame > 0)
+	{
+		MarkFramesChanged(0, _mStorage->Frames.size());
+	}
 }
 
 #include "HideWindowsPlatformTypes.h"
@@ -1,8 +1,11 @@
 #//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
 #include "Animation2D.h"
 #include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaColor.h"
+#include "ChromaDraw.h"
 #include "ChromaSDKPluginBPLibrary.h"
 #include "ChromaThread.h"
+#include <algorithm>
 
 #if PLATFORM_WINDOWS
 
@@ -10,6 +13,7 @@
 
 typedef unsigned char byte;
 #define ANIMATION_VERSION 1
+#define ANIMATION_VERSION_PALETTE 2
 
 using namespace ChromaSDK;
 using namespace std;
@@ -21,12 +25,14 @@ Animation2D::Animation2D()
 	Reset();
 }
 
+Animation2D::~Animation2D()
+{
+	Unload();
+}
+
 void Animation2D::Reset()
 {
-	_mFrames.clear();
-	FChromaSDKColorFrame2D frame = FChromaSDKColorFrame2D();
-	frame.Colors = UChromaSDKPluginBPLibrary::CreateColors2D(_mDevice);
-	_mFrames.push_back(frame);
+	_mStorage = make_shared<FChromaFrames2D>();
 
 	_mIsPlaying = false;
 	_mIsLoaded = false;
@@ -64,49 +70,261 @@ int Animation2D::GetDeviceId()
 	return (int)GetDevice();
 }
 
-vector<FChromaSDKColorFrame2D>& Animation2D::GetFrames()
+vector<FChromaFrame2D>& Animation2D::GetFrames()
+{
+	DecodeFrames();
+	return _mStorage->Frames;
+}
+
+int Animation2D::GetColorCount()
+{
+	return FChromaSDKPluginModule::GetMaxRow(_mDevice) * FChromaSDKPluginModule::GetMaxColumn(_mDevice);
+}
+
+const COLORREF* Animation2D::GetFrameColors(int index, COLORREF* scratch)
+{
+	if (_mStorage->Indexed)
+	{
+		Palette::Decode(_mStorage->Palette, _mStorage->IndexedFrames[index], scratch, GetColorCount());
+		return scratch;
+	}
+	if (_mStorage->RunLength)
+	{
+		RunLength::Decode(_mStorage->Runs, index, scratch, GetColorCount());
+		return scratch;
+	}
+	return _mStorage->Frames[index].Colors;
+}
+
+bool Animation2D::IsIndexed()
+{
+	return _mStorage->Indexed;
+}
+
+bool Animation2D::IndexFrames()
+{
+	if (_mStorage->Indexed)
+	{
+		return true;
+	}
+	DecodeFrames();
+	if (!Palette::Encode(_mStorage->Frames, GetColorCount(), _mStorage->Palette, _mStorage->IndexedFrames))
+	{
+		return false;
+	}
+	_mStorage->Frames.clear();
+	_mStorage->Indexed = true;
+	return true;
+}
+
+void Animation2D::SetIndexedFrames(vector<COLORREF>& palette, vector<FChromaIndexedFrame2D>& indexedFrames)
+{
+	DetachFrames();
+	_mStorage->Palette.swap(palette);
+	_mStorage->IndexedFrames.swap(indexedFrames);
+	_mStorage->Frames.clear();
+	_mStorage->RunLength = false;
+	_mStorage->Runs = FChromaRunFrames();
+	_mStorage->Indexed = true;
+}
+
+bool Animation2D::IsRunLength()
+{
+	return _mStorage->RunLength;
+}
+
+void Animation2D::EncodeRuns()
+{
+	if (_mStorage->RunLength)
+	{
+		return;
+	}
+	DecodeFrames();
+	RunLength::Encode(_mStorage->Frames, GetColorCount(), _mStorage->Runs);
+	_mStorage->Frames.clear();
+	_mStorage->RunLength = true;
+}
+
+void Animation2D::CompactFrames()
+{
+	DecodeFrames();
+	const int count = GetColorCount();
+	const int frameCount = _mStorage->Frames.size();
+	const size_t packedSize = frameCount * sizeof(FChromaFrame2D);
+	const size_t runSize = RunLength::GetSize(frameCount, count, RunLength::CountSegments(_mStorage->Frames, count));
+	vector<COLORREF> palette;
+	vector<FChromaIndexedFrame2D> indexedFrames;
+	size_t paletteSize = packedSize;
+	if (Palette::Encode(_mStorage->Frames, count, palette, indexedFrames))
+	{
+		paletteSize = frameCount * sizeof(FChromaIndexedFrame2D) + palette.size() * sizeof(COLORREF);
+	}
+	if (runSize < packedSize &&
+		runSize < paletteSize)
+	{
+		EncodeRuns();
+	}
+	else if (paletteSize < packedSize)
+	{
+		SetIndexedFrames(palette, indexedFrames);
+	}
+}
+
+void Animation2D::DetachFrames()
+{
+	if (_mStorage.use_count() > 1)
+	{
+		_mStorage = make_shared<FChromaFrames2D>(*_mStorage);
+	}
+}
+
+void Animation2D::ShareFrames(Animation2D* source)
+{
+	AnimationPairLock guard(this, source);
+	_mDevice = source->_mDevice;
+	_mStorage = source->_mStorage;
+	ResetPlayhead();
+	MarkFramesChanged(0, GetFrameCount());
+}
+
+void Animation2D::DecodeFrames()
+{
+	if (!_mStorage->RunLength &&
+		!_mStorage->Indexed)
+	{
+		DetachFrames();
+		return;
+	}
+	//decode into new storage and swap it in, the packed frames stay intact until the swap
+	shared_ptr<FChromaFrames2D> decoded = make_shared<FChromaFrames2D>();
+	const int count = GetColorCount();
+	if (_mStorage->RunLength)
+	{
+		RunLength::DecodeAll(_mStorage->Runs, count, decoded->Frames);
+	}
+	else
+	{
+		decoded->Frames.resize(_mStorage->IndexedFrames.size());
+		for (unsigned int index = 0; index < _mStorage->IndexedFrames.size(); ++index)
+		{
+			decoded->Frames[index].Duration = _mStorage->IndexedFrames[index].Duration;
+			Palette::Decode(_mStorage->Palette, _mStorage->IndexedFrames[index], decoded->Frames[index].Colors, count);
+		}
+	}
+	_mStorage = decoded;
+}
+
+void Animation2D::ReplaceColor(COLORREF color, COLORREF newColor)
 {
-	return _mFrames;
+	lock_guard<mutex> guard(_mFrameMutex);
+	DetachFrames();
+	bool replaced = false;
+	if (_mStorage->Indexed)
+	{
+		for (unsigned int i = 0; i < _mStorage->Palette.size(); ++i)
+		{
+			if (_mStorage->Palette[i] == color)
+			{
+				_mStorage->Palette[i] = newColor;
+				replaced = true;
+			}
+		}
+	}
+	else if (_mStorage->RunLength)
+	{
+		for (unsigned int i = 0; i < _mStorage->Runs.Segments.size(); ++i)
+		{
+			if (_mStorage->Runs.Segments[i].Color == color)
+			{
+				_mStorage->Runs.Segments[i].Color = newColor;
+				replaced = true;
+			}
+		}
+	}
+	else
+	{
+		const int count = GetColorCount();
+		for (unsigned int index = 0; index < _mStorage->Frames.size(); ++index)
+		{
+			COLORREF* colors = _mStorage->Frames[index].Colors;
+			for (int i = 0; i < count; ++i)
+			{
+				if (colors[i] == color)
+				{
+					colors[i] = newColor;
+					replaced = true;
+				}
+			}
+		}
+	}
+	if (replaced)
+	{
+		MarkFramesChanged(0, GetFrameCount());
+	}
 }
 
 int Animation2D::GetFrameCount()
 {
-	return _mFrames.size();
+	if (_mStorage->Indexed)
+	{
+		return _mStorage->IndexedFrames.size();
+	}
+	if (_mStorage->RunLength)
+	{
+		return _mStorage->Runs.Durations.size();
+	}
+	return _mStorage->Frames.size();
 }
 
 float Animation2D::GetDuration(unsigned int index)
 {
-	if (index < _mFrames.size())
+	if (_mStorage->Indexed)
+	{
+		return index < _mStorage->IndexedFrames.size() ? _mStorage->IndexedFrames[index].Duration : 0.0f;
+	}
+	if (_mStorage->RunLength)
+	{
+		return index < _mStorage->Runs.Durations.size() ? _mStorage->Runs.Durations[index] : 0.0f;
+	}
+	if (index < _mStorage->Frames.size())
 	{
-		FChromaSDKColorFrame2D& frame = _mFrames[index];
+		FChromaFrame2D& frame = _mStorage->Frames[index];
 		return frame.Duration;
 	}
 	return 0.0f;
 }
 
+FChromaSDKEffectResult Animation2D::CreateEffect(int index)
+{
+	FChromaSDKEffectResult effect = FChromaSDKEffectResult();
+	COLORREF colors[MAX_COLORS_2D];
+	effect.Result = FChromaSDKPluginModule::Get().CreateEffectCustom2D(_mDevice, GetFrameColors(index, colors), &effect.EffectId.Data);
+	return effect;
+}
+
 void Animation2D::Load()
 {
-	if (_mIsLoaded)
+	//rebuild the effects under the lock the worker shows them under
+	lock_guard<mutex> guard(_mFrameMutex);
+
+	//incremental, frames that have effects and are unchanged are skipped
+	if (_mIsLoaded &&
+		!_mHasChanges &&
+		_mEffects.size() == GetFrameCount())
 	{
 		return;
 	}
 
-	for (unsigned int i = 0; i < _mFrames.size(); ++i)
-	{
-		FChromaSDKColorFrame2D& frame = _mFrames[i];
-		FChromaSDKEffectResult effect = UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom2D(_mDevice, frame.Colors);
-		if (effect.Result != 0)
-		{
-			fprintf(stderr, "Load: Failed to create effect!\r\n");
-		}
-		_mEffects.push_back(effect);
-	}
+	SyncEffects();
 
 	_mIsLoaded = true;
 }
 
 void Animation2D::Unload()
 {
+	//the worker reads the effects under the same lock
+	lock_guard<mutex> guard(_mFrameMutex);
+
 	if (!_mIsLoaded)
 	{
 		return;
@@ -127,20 +345,24 @@ void Animation2D::Unload()
 
 void Animation2D::Play(bool loop)
 {
-	if (!_mIsLoaded)
+	Start(loop);
+
+	if (ChromaThread::Instance())
 	{
-		Load();
+		ChromaThread::Instance()->AddAnimation(this);
 	}
+}
+
+void Animation2D::Start(bool loop)
+{
+	//creates missing effects and picks up edits made while stopped
+	Load();
 
 	_mTime = 0.0f;
+	_mOvershoot = 0.0f;
 	_mCurrentFrame = -1;
 	_mIsPlaying = true;
 	_mLoop = loop;
-
-	if (ChromaThread::Instance())
-	{
-		ChromaThread::Instance()->AddAnimation(this);
-	}
 }
 
 void Animation2D::Stop()
@@ -160,67 +382,69 @@ void Animation2D::Update(float deltaTime)
 		return;
 	}
 
+	//edits replace the frame storage, hold the lock for the whole step
+	lock_guard<mutex> guard(_mFrameMutex);
+
+	//apply edits made since the last update
+	PublishChanges();
+
 	if (_mCurrentFrame == -1)
 	{
 		_mCurrentFrame = 0;
-		if (_mCurrentFrame < _mEffects.size())
-		{
-			FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-			int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-			if (result != 0)
-			{
-				fprintf(stderr, "Play: Failed to set effect!\r\n");
-			}
-		}
+		ShowCurrentFrame(true);
+		return;
 	}
-	else
+
+	//carry the overshoot into the next frame so the playhead follows the elapsed time,
+	//animations started on the same tick stay on the same frame boundaries
+	_mTime += deltaTime;
+	const int frameCount = _mEffects.size();
+	int steps = 0;
+	float nextTime = GetDuration(_mCurrentFrame);
+	while (nextTime < _mTime)
 	{
-		_mTime += deltaTime;
-		float nextTime = GetDuration(_mCurrentFrame);
-		if (nextTime < _mTime)
+		_mTime -= nextTime;
+		++_mCurrentFrame;
+		++steps;
+		if (_mCurrentFrame >= frameCount)
 		{
-			_mTime = 0.0f;
-			++_mCurrentFrame;
-			if (_mCurrentFrame < _mEffects.size())
+			if (_mLoop)
 			{
-				FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-				int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-				if (result != 0)
-				{
-					fprintf(stderr, "Update: Failed to set effect!\r\n");
-				}
+				_mCurrentFrame = 0;
+				PostEvent(EChromaSDKAnimationEventEnum::AE_Loop);
 			}
 			else
 			{
-				if (_mLoop)
-				{
-					_mTime = 0.0f;
-					_mCurrentFrame = -1;
-				}
-				else
-				{
-					//fprintf(stdout, "Update: Animation Complete.\r\n");
-					_mIsPlaying = false;
-					_mTime = 0.0f;
-					_mCurrentFrame = 0;
-				}
+				//fprintf(stdout, "Update: Animation Complete.\r\n");
+				_mIsPlaying = false;
+				_mOvershoot = _mTime;
+				_mTime = 0.0f;
+				_mCurrentFrame = 0;
+				PostEvent(EChromaSDKAnimationEventEnum::AE_Complete);
+				return;
 			}
 		}
+		if (steps > frameCount)
+		{
+			//zero length frames, drop the rest of the step
+			_mTime = 0.0f;
+			break;
+		}
+		nextTime = GetDuration(_mCurrentFrame);
+	}
+	if (steps > 0)
+	{
+		//frames identical to the previous frame leave the device as is, unless frames were skipped
+		ShowCurrentFrame(steps > 1);
 	}
 }
 
 void Animation2D::ResetFrames()
 {
+	lock_guard<mutex> guard(_mFrameMutex);
 	_mCurrentFrame = 0;
-	while (_mFrames.size() > 0)
-	{
-		auto it = _mFrames.begin();
-		_mFrames.erase(it);
-	}
-	FChromaSDKColorFrame2D frame = FChromaSDKColorFrame2D();
-	frame.Colors = UChromaSDKPluginBPLibrary::CreateColors2D(_mDevice);
-	frame.Duration = 1;
-	_mFrames.push_back(frame);
+	_mStorage = make_shared<FChromaFrames2D>();
+	MarkFrameChanged(0);
 }
 
 int Animation2D::Save(const char* path)
@@ -235,92 +459,282 @@ int Animation2D::Save(const char* path)
 	else if (0 == result &&
 		stream)
 	{
-		long write = 0;
-		long expectedWrite = 1;
-		long expectedSize = 0;
+		result = Write(stream);
+		fflush(stream);
+		std::fclose(stream);
+		return result;
+	}
+
+	return -1;
+}
+
+int Animation2D::Write(FILE* stream)
+{
+	//playing animations can be edited, save a consistent copy of the frames
+	lock_guard<mutex> guard(_mFrameMutex);
+
+	long write = 0;
+	long expectedWrite = 1;
+	long expectedSize = 0;
+
+	int version = _mStorage->Indexed ? ANIMATION_VERSION_PALETTE : ANIMATION_VERSION;
+	expectedSize = sizeof(int);
+	write = fwrite(&version, expectedSize, 1, stream);
+	if (expectedWrite != write)
+	{
+		fprintf(stderr, "Save: Failed to write version!\r\n");
+		return -1;
+	}
+
+	//device type
+	byte deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_2D;
+	expectedSize = sizeof(byte);
+	fwrite(&deviceType, expectedSize, 1, stream);
+
+	switch ((EChromaSDKDeviceTypeEnum)deviceType)
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 1D\r\n"));
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 2D\r\n"));
+		break;
+	}
+
+	//device
+	byte device = (byte)_mDevice;
+	fwrite(&device, expectedSize, 1, stream);
+
+	switch ((EChromaSDKDevice2DEnum)device)
+	{
+	case EChromaSDKDevice2DEnum::DE_Keyboard:
+		UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Keyboard\r\n"));
+		break;
+	case EChromaSDKDevice2DEnum::DE_Keypad:
+		UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Keypad\r\n"));
+		break;
+	case EChromaSDKDevice2DEnum::DE_Mouse:
+		UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Mouse\r\n"));
+		break;
+	}
+
+	//frame count
+	unsigned int frameCount = GetFrameCount();
+	expectedSize = sizeof(unsigned int);
+	fwrite(&frameCount, expectedSize, 1, stream);
 
-		int version = ANIMATION_VERSION;
+	UE_LOG(LogTemp, Log, TEXT("Save: FrameCount: %d\r\n"), frameCount);
+
+	//palette
+	if (_mStorage->Indexed)
+	{
+		int paletteSize = _mStorage->Palette.size();
 		expectedSize = sizeof(int);
-		write = fwrite(&version, expectedSize, 1, stream);
-		if (expectedWrite != write)
-		{
-			fprintf(stderr, "Save: Failed to write version!\r\n");
-			std::fclose(stream);
-			return -1;
-		}
+		fwrite(&paletteSize, expectedSize, 1, stream);
+		fwrite(_mStorage->Palette.data(), expectedSize, paletteSize, stream);
+	}
 
-		//device type
-		byte deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_2D;
-		expectedSize = sizeof(byte);
-		fwrite(&deviceType, expectedSize, 1, stream);
+	//frames
+	for (unsigned int index = 0; index < frameCount; ++index)
+	{
+		//duration
+		float duration = GetDuration(index);
+		expectedSize = sizeof(float);
+		fwrite(&duration, expectedSize, 1, stream);
 
-		switch ((EChromaSDKDeviceTypeEnum)deviceType)
+		//colors
+		if (_mStorage->Indexed)
 		{
-		case EChromaSDKDeviceTypeEnum::DE_1D:
-			UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 1D\r\n"));
-			break;
-		case EChromaSDKDeviceTypeEnum::DE_2D:
-			UE_LOG(LogTemp, Log, TEXT("Save: DeviceType: 2D\r\n"));
-			break;
+			FChromaIndexedFrame2D& frame = _mStorage->IndexedFrames[index];
+			expectedSize = sizeof(uint8);
+			fwrite(frame.Indices, expectedSize, GetColorCount(), stream);
 		}
+		else
+		{
+			// run-length frames are saved packed
+			COLORREF scratch[MAX_COLORS_2D];
+			expectedSize = sizeof(int);
+			fwrite(GetFrameColors(index, scratch), expectedSize, GetColorCount(), stream);
+		}
+	}
 
-		//device
-		byte device = (byte)_mDevice;
-		fwrite(&device, expectedSize, 1, stream);
+	return 0;
+}
+
+void Animation2D::FillFrames(int startFrame, int endFrame, COLORREF color)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	DecodeFrames();
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	const int count = GetColorCount();
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		Draw::FillSpan(_mStorage->Frames[index].Colors, count, color);
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		switch ((EChromaSDKDevice2DEnum)device)
+void Animation2D::CopyRegion(Animation2D* source, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns)
+{
+	AnimationPairLock guard(this, source);
+	if (nullptr == source ||
+		source->GetDevice() != _mDevice)
+	{
+		return;
+	}
+	const int sourceFrameCount = source->GetFrameCount();
+	if (sourceFrameCount == 0 ||
+		!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	DecodeFrames();
+	COLORREF scratch[MAX_COLORS_2D];
+	const int maxColumn = FChromaSDKPluginModule::GetMaxColumn(_mDevice);
+	int endRow = FMath::Min(startRow + rows, FChromaSDKPluginModule::GetMaxRow(_mDevice));
+	int endColumn = FMath::Min(startColumn + columns, maxColumn);
+	startRow = FMath::Max(startRow, 0);
+	startColumn = FMath::Max(startColumn, 0);
+	if (startColumn >= endColumn)
+	{
+		return;
+	}
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		const COLORREF* sourceColors = source->GetFrameColors(index % sourceFrameCount, scratch);
+		COLORREF* targetColors = _mStorage->Frames[index].Colors;
+		for (int i = startRow; i < endRow; ++i)
 		{
-		case EChromaSDKDevice2DEnum::DE_Keyboard:
-			UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Keyboard\r\n"));
-			break;
-		case EChromaSDKDevice2DEnum::DE_Keypad:
-			UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Keypad\r\n"));
-			break;
-		case EChromaSDKDevice2DEnum::DE_Mouse:
-			UE_LOG(LogTemp, Log, TEXT("Save: Device: DE_Mouse\r\n"));
-			break;
+			const int offset = i * maxColumn + startColumn;
+			memcpy(targetColors + offset, sourceColors + offset, (endColumn - startColumn) * sizeof(COLORREF));
 		}
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		//frame count
-		unsigned int frameCount = _mFrames.size();
-		expectedSize = sizeof(unsigned int);
-		fwrite(&frameCount, expectedSize, 1, stream);
+void Animation2D::CopyNonZeroFrames(Animation2D* source, int startFrame, int endFrame)
+{
+	AnimationPairLock guard(this, source);
+	if (nullptr == source ||
+		source->GetDevice() != _mDevice)
+	{
+		return;
+	}
+	const int sourceFrameCount = source->GetFrameCount();
+	if (sourceFrameCount == 0 ||
+		!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	DecodeFrames();
+	COLORREF scratch[MAX_COLORS_2D];
+	const int count = GetColorCount();
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		Color::CopyNonZero(source->GetFrameColors(index % sourceFrameCount, scratch), _mStorage->Frames[index].Colors, count);
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		UE_LOG(LogTemp, Log, TEXT("Save: FrameCount: %d\r\n"), frameCount);
+void Animation2D::MultiplyFrames(int startFrame, int endFrame, float intensity)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	DecodeFrames();
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	const int count = GetColorCount();
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		Color::Multiply(_mStorage->Frames[index].Colors, count, intensity);
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		//frames
-		for (unsigned int index = 0; index < frameCount; ++index)
+void Animation2D::ShiftFrames(int startFrame, int endFrame, int rowOffset, int columnOffset)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	DecodeFrames();
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	const int maxRow = FChromaSDKPluginModule::GetMaxRow(_mDevice);
+	const int maxColumn = FChromaSDKPluginModule::GetMaxColumn(_mDevice);
+	//the columns that stay on the grid are the same for every row
+	const int startColumn = FMath::Clamp(columnOffset, 0, maxColumn);
+	const int endColumn = FMath::Clamp(maxColumn + columnOffset, 0, maxColumn);
+	COLORREF shifted[MAX_COLORS_2D];
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		COLORREF* colors = _mStorage->Frames[index].Colors;
+		memset(shifted, 0, sizeof(shifted));
+		for (int i = 0; i < maxRow; ++i)
 		{
-			//duration
-			float duration = GetDuration(index);
-			expectedSize = sizeof(float);
-			fwrite(&duration, expectedSize, 1, stream);
-
-			//colors
-			if (index < _mFrames.size())
+			int sourceRow = i - rowOffset;
+			if (sourceRow < 0 ||
+				sourceRow >= maxRow ||
+				startColumn >= endColumn)
 			{
-				FChromaSDKColorFrame2D& frame = _mFrames[index];
-				for (int i = 0; i < frame.Colors.Num(); ++i)
-				{
-					FChromaSDKColors& row = frame.Colors[i];
-					for (int j = 0; j < row.Colors.Num(); ++j)
-					{
-						//color
-						int color = FChromaSDKPluginModule::ToBGR(row.Colors[j]);
-						expectedSize = sizeof(int);
-						fwrite(&color, expectedSize, 1, stream);
-					}
-				}
+				continue;
 			}
+			memcpy(shifted + i * maxColumn + startColumn,
+				colors + sourceRow * maxColumn + startColumn - columnOffset,
+				(endColumn - startColumn) * sizeof(COLORREF));
 		}
+		memcpy(colors, shifted, maxRow * maxColumn * sizeof(COLORREF));
+	}
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		fflush(stream);
-		std::fclose(stream);
+void Animation2D::ReverseFrames(int startFrame, int endFrame)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	DecodeFrames();
+	ResetPlayhead();
+	reverse(_mStorage->Frames.begin() + startFrame, _mStorage->Frames.begin() + endFrame);
+	MarkFramesChanged(startFrame, endFrame);
+}
 
-		return 0;
+void Animation2D::DuplicateFrames(int startFrame, int endFrame)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
 	}
+	DecodeFrames();
+	ResetPlayhead();
+	vector<FChromaFrame2D> duplicates(_mStorage->Frames.begin() + startFrame, _mStorage->Frames.begin() + endFrame);
+	_mStorage->Frames.insert(_mStorage->Frames.begin() + endFrame, duplicates.begin(), duplicates.end());
+	//frames after the range moved
+	MarkFramesChanged(endFrame, _mStorage->Frames.size());
+}
 
-	return -1;
+void Animation2D::TrimFrames(int startFrame, int endFrame)
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	DecodeFrames();
+	ResetPlayhead();
+	_mStorage->Frames.erase(_mStorage->Frames.begin() + endFrame, _mStorage->Frames.end());
+	_mStorage->Frames.erase(_mStorage->Frames.begin(), _mStorage->Frames.begin() + startFrame);
+	//the remaining frames moved to the front, the extra effects are released on load
+	if (startFrame > 0)
+	{
+		MarkFramesChanged(0, _mStorage->Frames.size());
+	}
 }
 
 #include "HideWindowsPlatformTypes.h"
@@ -1,6 +1,9 @@
 #//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
 #include "AnimationBase.h"
 #include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaSDKPluginBPLibrary.h"
+#include "ChromaFrame.h"
+#include "ChromaThread.h"
 
 using namespace ChromaSDK;
 using namespace std;
@@ -9,7 +12,20 @@ AnimationBase::AnimationBase()
 {
 	_mCurrentFrame = 0;
 	_mIsPlaying = false;
+	_mMuted = false;
 	_mTime = 0.0f;
+	_mOvershoot = 0.0f;
+	_mHasChanges = false;
+	_mVersion = 0;
+	_mTimeScale = 1.0f;
+	_mPaused = false;
+	_mClosed = false;
+	_mAnimationId = -1;
+	_mShownCount = 0;
+}
+
+AnimationBase::~AnimationBase()
+{
 }
 
 const string& AnimationBase::GetName()
@@ -22,6 +38,25 @@ void AnimationBase::SetName(const std::string& name)
 	_mName = name;
 }
 
+void AnimationBase::SetTimeScale(float timeScale)
+{
+	_mTimeScale = timeScale < 0.0f ? 0.0f : timeScale;
+}
+
+void AnimationBase::SetPaused(bool paused)
+{
+	_mPaused = paused;
+}
+
+float AnimationBase::ScaleTime(float deltaTime)
+{
+	if (_mPaused)
+	{
+		return 0.0f;
+	}
+	return deltaTime * _mTimeScale;
+}
+
 int AnimationBase::GetDeviceTypeId()
 {
 	return (int)GetDeviceType();
@@ -45,4 +80,302 @@ void AnimationBase::SetCurrentFrame(int index)
 bool AnimationBase::IsPlaying()
 {
 	return _mIsPlaying;
-}
\ No newline at end of file
+}
+
+float AnimationBase::GetOvershoot()
+{
+	return _mOvershoot;
+}
+
+void AnimationBase::Finish()
+{
+	_mIsPlaying = false;
+}
+
+void AnimationBase::SetMuted(bool muted)
+{
+	_mMuted = muted;
+}
+
+bool AnimationBase::IsMuted()
+{
+	return _mMuted;
+}
+
+void AnimationBase::RefreshDevice()
+{
+	lock_guard<mutex> guard(_mFrameMutex);
+	ShowCurrentFrame(true);
+}
+
+bool AnimationBase::ClampFrameRange(int& startFrame, int& endFrame)
+{
+	int frameCount = GetFrameCount();
+	if (startFrame < 0)
+	{
+		startFrame = 0;
+	}
+	if (endFrame < 0 ||
+		endFrame > frameCount)
+	{
+		endFrame = frameCount;
+	}
+	return startFrame < endFrame;
+}
+
+void AnimationBase::ResetPlayhead()
+{
+	_mCurrentFrame = 0;
+	_mTime = 0.0f;
+}
+
+void AnimationBase::PostEvent(EChromaSDKAnimationEventEnum type)
+{
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->PostEvent(this, type);
+	}
+}
+
+mutex& AnimationBase::GetFrameMutex()
+{
+	return _mFrameMutex;
+}
+
+void AnimationBase::MarkFrameChanged(int index)
+{
+	MarkFramesChanged(index, index + 1);
+}
+
+void AnimationBase::MarkFramesChanged(int startFrame, int endFrame)
+{
+	if (!ClampFrameRange(startFrame, endFrame))
+	{
+		return;
+	}
+	if (_mChangedFrames.size() < (unsigned int)endFrame)
+	{
+		_mChangedFrames.resize(endFrame, false);
+	}
+	for (int index = startFrame; index < endFrame; ++index)
+	{
+		_mChangedFrames[index] = true;
+	}
+	_mHasChanges = true;
+	++_mVersion;
+}
+
+unsigned int AnimationBase::GetVersion()
+{
+	return _mVersion;
+}
+
+void AnimationBase::Close()
+{
+	_mClosed = true;
+}
+
+bool AnimationBase::IsClosed()
+{
+	return _mClosed;
+}
+
+void AnimationBase::SetAnimationId(int animationId)
+{
+	_mAnimationId = animationId;
+}
+
+int AnimationBase::GetAnimationId()
+{
+	if (_mClosed)
+	{
+		return -1;
+	}
+	return _mAnimationId;
+}
+
+void AnimationBase::SyncEffects()
+{
+#if PLATFORM_WINDOWS
+	unsigned int frameCount = GetFrameCount();
+
+	//release effects for frames that no longer exist
+	while (_mEffects.size() > frameCount)
+	{
+		FChromaSDKEffectResult& effect = _mEffects.back();
+		int result = UChromaSDKPluginBPLibrary::ChromaSDKDeleteEffect(effect.EffectId);
+		if (result != 0)
+		{
+			fprintf(stderr, "SyncEffects: Failed to delete effect!\r\n");
+		}
+		_mEffects.pop_back();
+	}
+
+	_mChangedFrames.resize(frameCount, false);
+
+	for (unsigned int i = 0; i < frameCount; ++i)
+	{
+		if (i < _mEffects.size())
+		{
+			if (!_mChangedFrames[i])
+			{
+				continue;
+			}
+			FChromaSDKEffectResult& effect = _mEffects[i];
+			int result = UChromaSDKPluginBPLibrary::ChromaSDKDeleteEffect(effect.EffectId);
+			if (result != 0)
+			{
+				fprintf(stderr, "SyncEffects: Failed to delete effect!\r\n");
+			}
+			effect = CreateEffect(i);
+		}
+		else
+		{
+			_mEffects.push_back(CreateEffect(i));
+		}
+
+		FChromaSDKEffectResult& effect = _mEffects[i];
+		if (effect.Result != 0)
+		{
+			fprintf(stderr, "SyncEffects: Failed to create effect!\r\n");
+		}
+		else if (_mIsPlaying &&
+			!_mMuted &&
+			_mCurrentFrame == (int)i)
+		{
+			int result = ShowEffect(effect);
+			if (result != 0)
+			{
+				fprintf(stderr, "SyncEffects: Failed to set effect!\r\n");
+			}
+		}
+	}
+
+	UpdateFrameDiffs();
+
+	_mChangedFrames.assign(frameCount, false);
+	_mHasChanges = false;
+#endif
+}
+
+void AnimationBase::UpdateFrameDiffs()
+{
+#if PLATFORM_WINDOWS
+	const int frameCount = GetFrameCount();
+	const int count = GetColorCount();
+	// frames only keep their place while the frame count stays the same
+	const bool all = (int)_mDiffIndices.size() != frameCount;
+	_mDiffIndices.resize(frameCount);
+	COLORREF previousScratch[MAX_COLORS_2D];
+	COLORREF scratch[MAX_COLORS_2D];
+	// the frame held in previousScratch, consecutive frames decode once
+	int held = -1;
+	for (int index = 0; index < frameCount; ++index)
+	{
+		const int previousIndex = index == 0 ? frameCount - 1 : index - 1;
+		if (!all &&
+			!_mChangedFrames[index] &&
+			!_mChangedFrames[previousIndex])
+		{
+			continue;
+		}
+		if (held != previousIndex)
+		{
+			const COLORREF* previous = GetFrameColors(previousIndex, previousScratch);
+			// packed frames return their own storage, copy so the previous frame can be overwritten
+			if (previous != previousScratch)
+			{
+				memcpy(previousScratch, previous, count * sizeof(COLORREF));
+			}
+		}
+		const COLORREF* colors = GetFrameColors(index, scratch);
+		vector<uint8>& indices = _mDiffIndices[index];
+		indices.clear();
+		for (int i = 0; i < count; ++i)
+		{
+			if (colors[i] != previousScratch[i])
+			{
+				indices.push_back((uint8)i);
+			}
+		}
+		memcpy(previousScratch, colors, count * sizeof(COLORREF));
+		held = index;
+	}
+#endif
+}
+
+int AnimationBase::GetChangedCount(int index)
+{
+	if (index < 0 ||
+		index >= (int)_mDiffIndices.size())
+	{
+		return 0;
+	}
+	return (int)_mDiffIndices[index].size();
+}
+
+const uint8* AnimationBase::GetChangedIndices(int index)
+{
+	if (GetChangedCount(index) == 0)
+	{
+		return nullptr;
+	}
+	return _mDiffIndices[index].data();
+}
+
+void AnimationBase::ShowCurrentFrame(bool force)
+{
+#if PLATFORM_WINDOWS
+	if (_mMuted ||
+		_mCurrentFrame < 0 ||
+		_mCurrentFrame >= (int)_mEffects.size())
+	{
+		return;
+	}
+	//canvases, transitions and players share the device, skip only while the previous frame is still showing
+	if (!force &&
+		GetChangedCount(_mCurrentFrame) == 0 &&
+		FChromaSDKPluginModule::Get().GetShowCount(GetDeviceTypeId(), GetDeviceId()) == _mShownCount)
+	{
+		return;
+	}
+	FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
+	int result = ShowEffect(effect);
+	if (result != 0)
+	{
+		fprintf(stderr, "ShowCurrentFrame: Failed to set effect!\r\n");
+	}
+#endif
+}
+
+int AnimationBase::ShowEffect(const FChromaSDKEffectResult& effect)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().ChromaSDKSetEffect(effect.EffectId.Data, GetDeviceTypeId(), GetDeviceId(), &_mShownCount);
+#else
+	return -1;
+#endif
+}
+
+void AnimationBase::PublishChanges()
+{
+	if (!_mHasChanges ||
+		!_mIsLoaded)
+	{
+		return;
+	}
+	SyncEffects();
+}
+
+AnimationPairLock::AnimationPairLock(AnimationBase* target, AnimationBase* source) :
+	_mTargetGuard(target->GetFrameMutex(), defer_lock)
+{
+	if (source == nullptr ||
+		source == target)
+	{
+		_mTargetGuard.lock();
+		return;
+	}
+	_mSourceGuard = unique_lock<mutex>(source->GetFrameMutex(), defer_lock);
+	std::lock(_mTargetGuard, _mSourceGuard);
+}
@@ -0,0 +1,168 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "AnimationComposite.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaCanvas.h"
+#include "ChromaThread.h"
+#include <algorithm>
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+#define ANIMATION_VERSION_COMPOSITE 3
+
+using namespace ChromaSDK;
+using namespace std;
+
+static EChromaSDKDeviceEnum GetTrackDevice(AnimationBase* track)
+{
+	switch (track->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		return ChromaCanvas::ToDevice((EChromaSDKDevice1DEnum)track->GetDeviceId());
+	default:
+		return ChromaCanvas::ToDevice((EChromaSDKDevice2DEnum)track->GetDeviceId());
+	}
+}
+
+AnimationComposite::AnimationComposite()
+{
+}
+
+const string& AnimationComposite::GetName()
+{
+	return _mName;
+}
+
+void AnimationComposite::SetName(const string& name)
+{
+	_mName = name;
+}
+
+bool AnimationComposite::AddTrack(AnimationBase* track)
+{
+	if (nullptr == track ||
+		nullptr != GetTrack(GetTrackDevice(track)))
+	{
+		return false;
+	}
+	_mTracks.push_back(track);
+	return true;
+}
+
+void AnimationComposite::RemoveTrack(AnimationBase* track)
+{
+	auto it = find(_mTracks.begin(), _mTracks.end(), track);
+	if (it != _mTracks.end())
+	{
+		_mTracks.erase(it);
+	}
+}
+
+const vector<AnimationBase*>& AnimationComposite::GetTracks()
+{
+	return _mTracks;
+}
+
+AnimationBase* AnimationComposite::GetTrack(EChromaSDKDeviceEnum device)
+{
+	for (unsigned int i = 0; i < _mTracks.size(); ++i)
+	{
+		if (GetTrackDevice(_mTracks[i]) == device)
+		{
+			return _mTracks[i];
+		}
+	}
+	return nullptr;
+}
+
+void AnimationComposite::Play(bool loop)
+{
+	for (unsigned int i = 0; i < _mTracks.size(); ++i)
+	{
+		_mTracks[i]->Start(loop);
+	}
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->AddAnimations(_mTracks);
+	}
+}
+
+void AnimationComposite::Stop()
+{
+	for (unsigned int i = 0; i < _mTracks.size(); ++i)
+	{
+		_mTracks[i]->Stop();
+	}
+}
+
+bool AnimationComposite::IsPlaying()
+{
+	for (unsigned int i = 0; i < _mTracks.size(); ++i)
+	{
+		if (_mTracks[i]->IsPlaying())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void AnimationComposite::SetTimeScale(float timeScale)
+{
+	for (unsigned int i = 0; i < _mTracks.size(); ++i)
+	{
+		_mTracks[i]->SetTimeScale(timeScale);
+	}
+}
+
+void AnimationComposite::SetPaused(bool paused)
+{
+	for (unsigned int i = 0; i < _mTracks.size(); ++i)
+	{
+		_mTracks[i]->SetPaused(paused);
+	}
+}
+
+int AnimationComposite::Save(const char* path)
+{
+	FILE* stream;
+	int result = fopen_s(&stream, path, "wb");
+	if (result == 13)
+	{
+		fprintf(stderr, "Save: Permission denied! %s\r\n", path);
+		return -1;
+	}
+	else if (0 != result ||
+		nullptr == stream)
+	{
+		return -1;
+	}
+
+	//header, then each track as a complete single device animation
+	int version = ANIMATION_VERSION_COMPOSITE;
+	int trackCount = _mTracks.size();
+	if (fwrite(&version, sizeof(int), 1, stream) != 1 ||
+		fwrite(&trackCount, sizeof(int), 1, stream) != 1)
+	{
+		fprintf(stderr, "Save: Failed to write composite header!\r\n");
+		std::fclose(stream);
+		return -1;
+	}
+	for (int i = 0; i < trackCount; ++i)
+	{
+		if (_mTracks[i]->Write(stream) != 0)
+		{
+			std::fclose(stream);
+			return -1;
+		}
+	}
+
+	fflush(stream);
+	std::fclose(stream);
+	return 0;
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
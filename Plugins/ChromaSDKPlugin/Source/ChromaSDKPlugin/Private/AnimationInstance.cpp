@@ -0,0 +1,203 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "AnimationInstance.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaCanvas.h"
+#include "ChromaColor.h"
+#include "ChromaFrame.h"
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h" 
+
+using namespace ChromaSDK;
+using namespace std;
+
+AnimationInstance::AnimationInstance(AnimationBase* animation)
+{
+	_mAnimation = animation;
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		_mDevice = ChromaCanvas::ToDevice((EChromaSDKDevice1DEnum)animation->GetDeviceId());
+		break;
+	default:
+		_mDevice = ChromaCanvas::ToDevice((EChromaSDKDevice2DEnum)animation->GetDeviceId());
+		break;
+	}
+	_mSpeed = 1.0f;
+	_mIntensity = 1.0f;
+	_mRowOffset = 0;
+	_mColumnOffset = 0;
+	_mIsPlaying = false;
+	_mLoop = false;
+	_mChanged = false;
+	_mCurrentFrame = 0;
+	_mTime = 0.0f;
+}
+
+AnimationBase* AnimationInstance::GetAnimation()
+{
+	return _mAnimation;
+}
+
+EChromaSDKDeviceEnum AnimationInstance::GetDevice()
+{
+	lock_guard<mutex> guard(_mMutex);
+	return _mDevice;
+}
+
+void AnimationInstance::SetDevice(EChromaSDKDeviceEnum device)
+{
+	lock_guard<mutex> guard(_mMutex);
+	_mDevice = device;
+	_mChanged = true;
+}
+
+void AnimationInstance::SetSpeed(float speed)
+{
+	lock_guard<mutex> guard(_mMutex);
+	_mSpeed = FMath::Max(speed, 0.0f);
+}
+
+void AnimationInstance::SetIntensity(float intensity)
+{
+	lock_guard<mutex> guard(_mMutex);
+	_mIntensity = intensity;
+	_mChanged = true;
+}
+
+void AnimationInstance::SetOffset(int rowOffset, int columnOffset)
+{
+	lock_guard<mutex> guard(_mMutex);
+	_mRowOffset = rowOffset;
+	_mColumnOffset = columnOffset;
+	_mChanged = true;
+}
+
+void AnimationInstance::Play(bool loop)
+{
+	lock_guard<mutex> guard(_mMutex);
+	_mTime = 0.0f;
+	_mCurrentFrame = 0;
+	_mLoop = loop;
+	_mIsPlaying = true;
+	_mChanged = true;
+}
+
+void AnimationInstance::Stop()
+{
+	lock_guard<mutex> guard(_mMutex);
+	_mIsPlaying = false;
+	_mChanged = true;
+}
+
+bool AnimationInstance::IsPlaying()
+{
+	lock_guard<mutex> guard(_mMutex);
+	return _mIsPlaying;
+}
+
+bool AnimationInstance::Update(float deltaTime)
+{
+	lock_guard<mutex> guard(_mMutex);
+	bool changed = _mChanged;
+	_mChanged = false;
+	if (!_mIsPlaying)
+	{
+		return changed;
+	}
+	lock_guard<mutex> frameGuard(_mAnimation->GetFrameMutex());
+	const int frameCount = _mAnimation->GetFrameCount();
+	if (_mCurrentFrame >= frameCount)
+	{
+		_mCurrentFrame = 0;
+	}
+	_mTime += deltaTime * _mSpeed;
+	//carry the remainder into the next frame, bounded so zero durations can't spin
+	for (int step = 0; step < frameCount; ++step)
+	{
+		float duration = _mAnimation->GetDuration(_mCurrentFrame);
+		if (_mTime <= duration)
+		{
+			break;
+		}
+		_mTime -= duration;
+		++_mCurrentFrame;
+		changed = true;
+		if (_mCurrentFrame >= frameCount)
+		{
+			_mCurrentFrame = 0;
+			if (!_mLoop)
+			{
+				_mIsPlaying = false;
+				_mTime = 0.0f;
+				break;
+			}
+		}
+	}
+	return changed;
+}
+
+void AnimationInstance::Render(COLORREF* colors, int maxRow, int maxColumn)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (!_mIsPlaying)
+	{
+		return;
+	}
+
+	int rows = 1;
+	int columns = 0;
+	switch (_mAnimation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		columns = FChromaSDKPluginModule::GetMaxLeds((EChromaSDKDevice1DEnum)_mAnimation->GetDeviceId());
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		rows = FChromaSDKPluginModule::GetMaxRow((EChromaSDKDevice2DEnum)_mAnimation->GetDeviceId());
+		columns = FChromaSDKPluginModule::GetMaxColumn((EChromaSDKDevice2DEnum)_mAnimation->GetDeviceId());
+		break;
+	}
+
+	COLORREF frame[MAX_COLORS_2D];
+	{
+		lock_guard<mutex> frameGuard(_mAnimation->GetFrameMutex());
+		if (_mCurrentFrame >= _mAnimation->GetFrameCount())
+		{
+			return;
+		}
+		const COLORREF* source = _mAnimation->GetFrameColors(_mCurrentFrame, frame);
+		if (source != frame)
+		{
+			memcpy(frame, source, rows * columns * sizeof(COLORREF));
+		}
+	}
+	if (_mIntensity != 1.0f)
+	{
+		Color::Multiply(frame, rows * columns, _mIntensity);
+	}
+
+	//clip the source grid against the device grid
+	const int startColumn = FMath::Max(0, -_mColumnOffset);
+	const int endColumn = FMath::Min(columns, maxColumn - _mColumnOffset);
+	if (startColumn >= endColumn)
+	{
+		return;
+	}
+	for (int row = 0; row < rows; ++row)
+	{
+		const int targetRow = row + _mRowOffset;
+		if (targetRow < 0 ||
+			targetRow >= maxRow)
+		{
+			continue;
+		}
+		Color::CopyNonZero(frame + row * columns + startColumn,
+			colors + targetRow * maxColumn + startColumn + _mColumnOffset,
+			endColumn - startColumn);
+	}
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
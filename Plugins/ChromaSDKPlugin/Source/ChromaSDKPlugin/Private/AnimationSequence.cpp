@@ -0,0 +1,217 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "AnimationSequence.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaThread.h"
+#include <algorithm>
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+using namespace ChromaSDK;
+using namespace std;
+
+AnimationSequence::AnimationSequence()
+{
+	_mIsPlaying = false;
+	_mLoop = false;
+	_mIndex = 0;
+	_mPass = 0;
+}
+
+int AnimationSequence::AddItem(AnimationBase* animation, int loopCount)
+{
+	if (nullptr == animation)
+	{
+		return -1;
+	}
+	lock_guard<mutex> guard(_mMutex);
+	FSequenceItem item;
+	item.Animation = animation;
+	item.LoopCount = loopCount < 1 ? 1 : loopCount;
+	_mItems.push_back(item);
+	if (_mIsPlaying &&
+		(int)_mItems.size() == _mIndex + 2)
+	{
+		PreloadNext();
+	}
+	return _mItems.size() - 1;
+}
+
+void AnimationSequence::RemoveAnimation(AnimationBase* animation)
+{
+	lock_guard<mutex> guard(_mMutex);
+	bool removedCurrent = false;
+	int index = 0;
+	while (index < (int)_mItems.size())
+	{
+		if (_mItems[index].Animation != animation)
+		{
+			++index;
+			continue;
+		}
+		_mItems.erase(_mItems.begin() + index);
+		if (index < _mIndex)
+		{
+			--_mIndex;
+		}
+		else if (index == _mIndex)
+		{
+			removedCurrent = true;
+		}
+	}
+	if (!_mIsPlaying ||
+		!removedCurrent)
+	{
+		return;
+	}
+	//the next item takes the place of the removed one
+	_mPass = 0;
+	if (_mIndex >= (int)_mItems.size())
+	{
+		_mIndex = 0;
+		if (!_mLoop ||
+			_mItems.empty())
+		{
+			_mIsPlaying = false;
+			return;
+		}
+	}
+	_mItems[_mIndex].Animation->Start(false);
+	PreloadNext();
+}
+
+void AnimationSequence::Clear()
+{
+	Stop();
+	lock_guard<mutex> guard(_mMutex);
+	_mItems.clear();
+}
+
+int AnimationSequence::GetItemCount()
+{
+	lock_guard<mutex> guard(_mMutex);
+	return _mItems.size();
+}
+
+vector<AnimationBase*> AnimationSequence::GetAnimations()
+{
+	lock_guard<mutex> guard(_mMutex);
+	vector<AnimationBase*> animations;
+	for (unsigned int i = 0; i < _mItems.size(); ++i)
+	{
+		if (find(animations.begin(), animations.end(), _mItems[i].Animation) == animations.end())
+		{
+			animations.push_back(_mItems[i].Animation);
+		}
+	}
+	return animations;
+}
+
+void AnimationSequence::Play(bool loop)
+{
+	Stop();
+	{
+		lock_guard<mutex> guard(_mMutex);
+		if (_mItems.empty())
+		{
+			return;
+		}
+		_mLoop = loop;
+		_mIndex = 0;
+		_mPass = 0;
+		_mIsPlaying = true;
+		//the first item creates its effects here, the first tick only shows frame 0
+		_mItems[0].Animation->Start(false);
+		PreloadNext();
+	}
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->AddSequence(this);
+	}
+}
+
+void AnimationSequence::Stop()
+{
+	//ChromaThread updates under its own lock first, so leave it before taking the sequence lock
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->RemoveSequence(this);
+	}
+	lock_guard<mutex> guard(_mMutex);
+	if (_mIsPlaying &&
+		_mIndex < (int)_mItems.size())
+	{
+		_mItems[_mIndex].Animation->Finish();
+	}
+	_mIsPlaying = false;
+}
+
+bool AnimationSequence::IsPlaying()
+{
+	lock_guard<mutex> guard(_mMutex);
+	return _mIsPlaying;
+}
+
+void AnimationSequence::PreloadNext()
+{
+	int next = _mIndex + 1;
+	if (next >= (int)_mItems.size())
+	{
+		if (!_mLoop)
+		{
+			return;
+		}
+		next = 0;
+	}
+	//no-op when the effects are loaded and unchanged
+	_mItems[next].Animation->Load();
+}
+
+void AnimationSequence::Update(float deltaTime)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (!_mIsPlaying ||
+		_mItems.empty())
+	{
+		_mIsPlaying = false;
+		return;
+	}
+
+	AnimationBase* animation = _mItems[_mIndex].Animation;
+	animation->Update(animation->ScaleTime(deltaTime));
+
+	//zero length items could switch forever, one pass over the list per tick is enough
+	for (int switches = 0; !animation->IsPlaying() && switches <= (int)_mItems.size(); ++switches)
+	{
+		const float overshoot = animation->GetOvershoot();
+		++_mPass;
+		if (_mPass >= _mItems[_mIndex].LoopCount)
+		{
+			_mPass = 0;
+			++_mIndex;
+			if (_mIndex >= (int)_mItems.size())
+			{
+				_mIndex = 0;
+				if (!_mLoop)
+				{
+					_mIsPlaying = false;
+					return;
+				}
+			}
+		}
+		//the time past the end of the item plays into the next one
+		animation = _mItems[_mIndex].Animation;
+		animation->Start(false);
+		animation->Update(0.0f);
+		animation->Update(overshoot);
+		if (_mPass == 0)
+		{
+			PreloadNext();
+		}
+	}
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
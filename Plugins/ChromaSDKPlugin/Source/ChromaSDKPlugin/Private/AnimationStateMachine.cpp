@@ -0,0 +1,307 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "AnimationStateMachine.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaCanvas.h"
+#include "ChromaThread.h"
+#include <algorithm>
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+using namespace ChromaSDK;
+using namespace std;
+
+AnimationStateMachine::AnimationStateMachine()
+{
+	for (int i = 0; i < MAX_PARAMETERS; ++i)
+	{
+		_mParameters[i] = 0.0f;
+	}
+	_mCurrentState = -1;
+	_mIsPlaying = false;
+	_mEntered = false;
+}
+
+EChromaSDKDeviceEnum AnimationStateMachine::GetDevice(AnimationBase* animation)
+{
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		return ChromaCanvas::ToDevice((EChromaSDKDevice1DEnum)animation->GetDeviceId());
+	default:
+		return ChromaCanvas::ToDevice((EChromaSDKDevice2DEnum)animation->GetDeviceId());
+	}
+}
+
+int AnimationStateMachine::AddState(bool loop)
+{
+	lock_guard<mutex> guard(_mMutex);
+	FState state;
+	state.Loop = loop;
+	_mStates.push_back(state);
+	return _mStates.size() - 1;
+}
+
+bool AnimationStateMachine::AddStateAnimation(int state, AnimationBase* animation)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (nullptr == animation ||
+		state < 0 ||
+		state >= (int)_mStates.size())
+	{
+		return false;
+	}
+	vector<AnimationBase*>& animations = _mStates[state].Animations;
+	for (unsigned int i = 0; i < animations.size(); ++i)
+	{
+		if (GetDevice(animations[i]) == GetDevice(animation))
+		{
+			return false;
+		}
+	}
+	animations.push_back(animation);
+	return true;
+}
+
+int AnimationStateMachine::AddTransition(int fromState, int toState, int parameter, EChromaSDKCompareEnum compare, float value, float blendTime, EChromaSDKTransitionEnum type)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (fromState < -1 ||
+		fromState >= (int)_mStates.size() ||
+		toState < 0 ||
+		toState >= (int)_mStates.size() ||
+		parameter < 0 ||
+		parameter >= MAX_PARAMETERS)
+	{
+		return -1;
+	}
+	FStateTransition transition;
+	transition.From = fromState;
+	transition.To = toState;
+	transition.Parameter = parameter;
+	transition.Compare = compare;
+	transition.Value = value;
+	transition.BlendTime = blendTime;
+	transition.Type = type;
+	_mTransitions.push_back(transition);
+	return _mTransitions.size() - 1;
+}
+
+void AnimationStateMachine::RemoveAnimation(AnimationBase* animation)
+{
+	lock_guard<mutex> guard(_mMutex);
+	for (unsigned int i = 0; i < _mStates.size(); ++i)
+	{
+		vector<AnimationBase*>& animations = _mStates[i].Animations;
+		auto it = find(animations.begin(), animations.end(), animation);
+		if (it != animations.end())
+		{
+			animations.erase(it);
+		}
+	}
+}
+
+vector<AnimationBase*> AnimationStateMachine::GetAnimations()
+{
+	lock_guard<mutex> guard(_mMutex);
+	vector<AnimationBase*> animations;
+	for (unsigned int i = 0; i < _mStates.size(); ++i)
+	{
+		for (unsigned int j = 0; j < _mStates[i].Animations.size(); ++j)
+		{
+			AnimationBase* animation = _mStates[i].Animations[j];
+			if (find(animations.begin(), animations.end(), animation) == animations.end())
+			{
+				animations.push_back(animation);
+			}
+		}
+	}
+	return animations;
+}
+
+void AnimationStateMachine::SetParameter(int parameter, float value)
+{
+	if (parameter < 0 ||
+		parameter >= MAX_PARAMETERS)
+	{
+		return;
+	}
+	_mParameters[parameter].store(value, memory_order_relaxed);
+}
+
+float AnimationStateMachine::GetParameter(int parameter)
+{
+	if (parameter < 0 ||
+		parameter >= MAX_PARAMETERS)
+	{
+		return 0.0f;
+	}
+	return _mParameters[parameter].load(memory_order_relaxed);
+}
+
+int AnimationStateMachine::GetCurrentState()
+{
+	return _mCurrentState;
+}
+
+void AnimationStateMachine::Play(int state)
+{
+	Stop();
+	{
+		lock_guard<mutex> guard(_mMutex);
+		if (state < 0 ||
+			state >= (int)_mStates.size())
+		{
+			return;
+		}
+		//create every effect up front so state changes on the playback thread only rewind
+		for (unsigned int i = 0; i < _mStates.size(); ++i)
+		{
+			for (unsigned int j = 0; j < _mStates[i].Animations.size(); ++j)
+			{
+				_mStates[i].Animations[j]->Load();
+			}
+		}
+		_mCurrentState = state;
+		_mEntered = false;
+		_mIsPlaying = true;
+	}
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->AddStateMachine(this);
+	}
+}
+
+void AnimationStateMachine::Stop()
+{
+	//ChromaThread evaluates under its own lock first, so leave it before taking the graph lock
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->RemoveStateMachine(this);
+	}
+	vector<AnimationBase*> animations;
+	{
+		lock_guard<mutex> guard(_mMutex);
+		const int state = _mCurrentState;
+		if (_mIsPlaying &&
+			_mEntered &&
+			state >= 0 &&
+			state < (int)_mStates.size())
+		{
+			animations = _mStates[state].Animations;
+		}
+		_mIsPlaying = false;
+	}
+	for (unsigned int i = 0; i < animations.size(); ++i)
+	{
+		animations[i]->Stop();
+	}
+}
+
+bool AnimationStateMachine::IsPlaying()
+{
+	return _mIsPlaying;
+}
+
+bool AnimationStateMachine::IsConditionMet(const FStateTransition& transition)
+{
+	const float parameter = _mParameters[transition.Parameter].load(memory_order_relaxed);
+	switch (transition.Compare)
+	{
+	case EChromaSDKCompareEnum::CE_Greater:
+		return parameter > transition.Value;
+	case EChromaSDKCompareEnum::CE_GreaterOrEqual:
+		return parameter >= transition.Value;
+	case EChromaSDKCompareEnum::CE_Less:
+		return parameter < transition.Value;
+	case EChromaSDKCompareEnum::CE_LessOrEqual:
+		return parameter <= transition.Value;
+	case EChromaSDKCompareEnum::CE_Equal:
+		return parameter == transition.Value;
+	case EChromaSDKCompareEnum::CE_NotEqual:
+		return parameter != transition.Value;
+	}
+	return false;
+}
+
+bool AnimationStateMachine::Evaluate(FStateChange& change)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (!_mIsPlaying)
+	{
+		return false;
+	}
+
+	const int current = _mCurrentState;
+	int next = -1;
+	float blendTime = 0.0f;
+	EChromaSDKTransitionEnum type = EChromaSDKTransitionEnum::TE_Crossfade;
+	if (!_mEntered)
+	{
+		//the first state starts with a hard cut
+		next = current;
+		_mEntered = true;
+	}
+	else
+	{
+		for (unsigned int i = 0; i < _mTransitions.size(); ++i)
+		{
+			const FStateTransition& transition = _mTransitions[i];
+			if ((transition.From == current ||
+				transition.From == -1) &&
+				transition.To != current &&
+				IsConditionMet(transition))
+			{
+				next = transition.To;
+				blendTime = transition.BlendTime;
+				type = transition.Type;
+				break;
+			}
+		}
+		if (next < 0)
+		{
+			return false;
+		}
+	}
+
+	//pair the animations of both states by device
+	change.Devices.clear();
+	change.From.clear();
+	change.To.clear();
+	change.Loop = _mStates[next].Loop;
+	change.BlendTime = blendTime;
+	change.Type = type;
+	const vector<AnimationBase*>& to = _mStates[next].Animations;
+	for (unsigned int i = 0; i < to.size(); ++i)
+	{
+		change.Devices.push_back(GetDevice(to[i]));
+		change.From.push_back(nullptr);
+		change.To.push_back(to[i]);
+	}
+	if (next != current)
+	{
+		const vector<AnimationBase*>& from = _mStates[current].Animations;
+		for (unsigned int i = 0; i < from.size(); ++i)
+		{
+			const EChromaSDKDeviceEnum device = GetDevice(from[i]);
+			auto it = find(change.Devices.begin(), change.Devices.end(), device);
+			if (it != change.Devices.end())
+			{
+				change.From[it - change.Devices.begin()] = from[i];
+			}
+			else
+			{
+				change.Devices.push_back(device);
+				change.From.push_back(from[i]);
+				change.To.push_back(nullptr);
+			}
+		}
+	}
+	_mCurrentState = next;
+	return true;
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
@@ -0,0 +1,182 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaCanvas.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h" 
+
+using namespace ChromaSDK;
+using namespace std;
+
+static_assert(Mouse::MAX_ROW * Mouse::MAX_COLUMN <= ChromaCanvas::MAX_SIZE, "Mouse grid does not fit the canvas");
+static_assert(Keypad::MAX_ROW * Keypad::MAX_COLUMN <= ChromaCanvas::MAX_SIZE, "Keypad grid does not fit the canvas");
+static_assert(Mousepad::MAX_LEDS <= ChromaCanvas::MAX_SIZE, "Mousepad strip does not fit the canvas");
+
+ChromaCanvas::ChromaCanvas(EChromaSDKDeviceEnum device)
+{
+	_mDevice = device;
+	switch (device)
+	{
+	case EChromaSDKDeviceEnum::DE_ChromaLink:
+		_mMaxRow = 1;
+		_mMaxColumn = ChromaLink::MAX_LEDS;
+		break;
+	case EChromaSDKDeviceEnum::DE_Headset:
+		_mMaxRow = 1;
+		_mMaxColumn = Headset::MAX_LEDS;
+		break;
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+		_mMaxRow = Keyboard::MAX_ROW;
+		_mMaxColumn = Keyboard::MAX_COLUMN;
+		break;
+	case EChromaSDKDeviceEnum::DE_Keypad:
+		_mMaxRow = Keypad::MAX_ROW;
+		_mMaxColumn = Keypad::MAX_COLUMN;
+		break;
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		_mMaxRow = Mouse::MAX_ROW;
+		_mMaxColumn = Mouse::MAX_COLUMN;
+		break;
+	case EChromaSDKDeviceEnum::DE_Mousepad:
+	default:
+		_mMaxRow = 1;
+		_mMaxColumn = Mousepad::MAX_LEDS;
+		break;
+	}
+	memset(_mBuffers, 0, sizeof(_mBuffers));
+	_mBack = 0;
+	_mMiddle = 1;
+	_mFront = 2;
+}
+
+EChromaSDKDeviceEnum ChromaCanvas::GetDevice()
+{
+	return _mDevice;
+}
+
+EChromaSDKDeviceTypeEnum ChromaCanvas::GetDeviceType()
+{
+	switch (_mDevice)
+	{
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+	case EChromaSDKDeviceEnum::DE_Keypad:
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		return EChromaSDKDeviceTypeEnum::DE_2D;
+	default:
+		return EChromaSDKDeviceTypeEnum::DE_1D;
+	}
+}
+
+int ChromaCanvas::GetMaxRow()
+{
+	return _mMaxRow;
+}
+
+int ChromaCanvas::GetMaxColumn()
+{
+	return _mMaxColumn;
+}
+
+int ChromaCanvas::GetSize()
+{
+	return _mMaxRow * _mMaxColumn;
+}
+
+COLORREF* ChromaCanvas::GetBackBuffer()
+{
+	return _mBuffers[_mBack];
+}
+
+void ChromaCanvas::Commit()
+{
+	const COLORREF* committed = _mBuffers[_mBack];
+	_mBack = _mMiddle.exchange(_mBack | FRESH, memory_order_acq_rel) & INDEX_MASK;
+	//keep drawing on top of the committed frame
+	memcpy(_mBuffers[_mBack], committed, GetSize() * sizeof(COLORREF));
+}
+
+const COLORREF* ChromaCanvas::AcquireFront()
+{
+	if ((_mMiddle.load(memory_order_acquire) & FRESH) == 0)
+	{
+		return nullptr;
+	}
+	_mFront = _mMiddle.exchange(_mFront, memory_order_acq_rel) & INDEX_MASK;
+	return _mBuffers[_mFront];
+}
+
+void ChromaCanvas::Present()
+{
+	const COLORREF* colors = AcquireFront();
+	if (colors == nullptr)
+	{
+		return;
+	}
+	if (!FChromaSDKPluginModule::Get().IsInitialized())
+	{
+		return;
+	}
+	if (ShowColors(_mDevice, colors) != 0)
+	{
+		fprintf(stderr, "Present: Failed to set canvas effect!\r\n");
+	}
+}
+
+RZRESULT ChromaCanvas::ShowColors(EChromaSDKDeviceEnum device, const COLORREF* colors)
+{
+	FChromaSDKPluginModule& module = FChromaSDKPluginModule::Get();
+	RZRESULT result = -1;
+	switch (device)
+	{
+	case EChromaSDKDeviceEnum::DE_ChromaLink:
+		result = module.CreateEffectCustom1D(EChromaSDKDevice1DEnum::DE_ChromaLink, colors, nullptr);
+		break;
+	case EChromaSDKDeviceEnum::DE_Headset:
+		result = module.CreateEffectCustom1D(EChromaSDKDevice1DEnum::DE_Headset, colors, nullptr);
+		break;
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+		result = module.CreateEffectCustom2D(EChromaSDKDevice2DEnum::DE_Keyboard, colors, nullptr);
+		break;
+	case EChromaSDKDeviceEnum::DE_Keypad:
+		result = module.CreateEffectCustom2D(EChromaSDKDevice2DEnum::DE_Keypad, colors, nullptr);
+		break;
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		result = module.CreateEffectCustom2D(EChromaSDKDevice2DEnum::DE_Mouse, colors, nullptr);
+		break;
+	case EChromaSDKDeviceEnum::DE_Mousepad:
+		result = module.CreateEffectCustom1D(EChromaSDKDevice1DEnum::DE_Mousepad, colors, nullptr);
+		break;
+	}
+	return result;
+}
+
+EChromaSDKDeviceEnum ChromaCanvas::ToDevice(EChromaSDKDevice1DEnum device)
+{
+	switch (device)
+	{
+	case EChromaSDKDevice1DEnum::DE_Headset:
+		return EChromaSDKDeviceEnum::DE_Headset;
+	case EChromaSDKDevice1DEnum::DE_Mousepad:
+		return EChromaSDKDeviceEnum::DE_Mousepad;
+	default:
+		return EChromaSDKDeviceEnum::DE_ChromaLink;
+	}
+}
+
+EChromaSDKDeviceEnum ChromaCanvas::ToDevice(EChromaSDKDevice2DEnum device)
+{
+	switch (device)
+	{
+	case EChromaSDKDevice2DEnum::DE_Keypad:
+		return EChromaSDKDeviceEnum::DE_Keypad;
+	case EChromaSDKDevice2DEnum::DE_Mouse:
+		return EChromaSDKDeviceEnum::DE_Mouse;
+	default:
+		return EChromaSDKDeviceEnum::DE_Keyboard;
+	}
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
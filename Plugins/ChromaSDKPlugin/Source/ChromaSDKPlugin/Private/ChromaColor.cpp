@@ -0,0 +1,358 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaColor.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+#include <intrin.h>
+#include <immintrin.h>
+
+using namespace ChromaSDK;
+
+namespace
+{
+	bool HasAVX2()
+	{
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+		{
+			return false;
+		}
+		//the os has to save the ymm registers too
+		const int osxsave = 1 << 27;
+		const int avx = 1 << 28;
+		__cpuid(info, 1);
+		if ((info[2] & (osxsave | avx)) != (osxsave | avx) ||
+			(_xgetbv(0) & 6) != 6)
+		{
+			return false;
+		}
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	}
+
+	const bool _sHasAVX2 = HasAVX2();
+
+	//a where the select mask is set, b elsewhere
+	inline __m128i Select(__m128i mask, __m128i a, __m128i b)
+	{
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+
+	//(value * scale + 128) >> 8 for 16 bit lanes holding a byte, saturated to 255
+	inline __m128i MultiplySaturate(__m128i value, __m128i scale)
+	{
+		//a nonzero high half means the product is already past 255 << 8
+		__m128i fits = _mm_cmpeq_epi16(_mm_mulhi_epu16(value, scale), _mm_setzero_si128());
+		__m128i result = _mm_srli_epi16(_mm_adds_epu16(_mm_mullo_epi16(value, scale), _mm_set1_epi16(128)), 8);
+		return _mm_or_si128(result, _mm_andnot_si128(fits, _mm_set1_epi16(255)));
+	}
+
+	//scale to 0-255, clamp and round, max comes first so NaN becomes zero
+	inline __m128i ScaleToByte(const FLinearColor& color)
+	{
+		__m128 value = _mm_mul_ps(_mm_loadu_ps(&color.R), _mm_set1_ps(255.0f));
+		value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+		return _mm_cvtps_epi32(value);
+	}
+
+	inline COLORREF ToBGRSSE(const FLinearColor& color)
+	{
+		__m128i value = ScaleToByte(color);
+		value = _mm_packs_epi32(value, value);
+		value = _mm_packus_epi16(value, value);
+		return (COLORREF)_mm_cvtsi128_si32(value) & 0xFFFFFF;
+	}
+
+	inline void ToLinearColorSSE(COLORREF color, FLinearColor& result)
+	{
+		__m128i value = _mm_cvtsi32_si128((int)color);
+		value = _mm_unpacklo_epi8(value, _mm_setzero_si128());
+		value = _mm_unpacklo_epi16(value, _mm_setzero_si128());
+		__m128 linear = _mm_div_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(255.0f));
+		_mm_storeu_ps(&result.R, linear);
+		result.A = 1.0f;
+	}
+
+	void ToBGRAVX2(const FLinearColor* colors, COLORREF* result, int count)
+	{
+		const __m256 scale = _mm256_set1_ps(255.0f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+		const __m256i mask = _mm256_set1_epi32(0xFFFFFF);
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const float* source = &colors[i].R;
+			__m256i value[4];
+			for (int j = 0; j < 4; ++j)
+			{
+				__m256 pair = _mm256_mul_ps(_mm256_loadu_ps(source + j * 8), scale);
+				pair = _mm256_min_ps(_mm256_max_ps(pair, zero), scale);
+				value[j] = _mm256_cvtps_epi32(pair);
+			}
+			//packs work per 128 bit lane, the permute puts the pixels back in order
+			__m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(value[0], value[1]), _mm256_packs_epi32(value[2], value[3]));
+			packed = _mm256_permutevar8x32_epi32(packed, order);
+			_mm256_storeu_si256((__m256i*)(result + i), _mm256_and_si256(packed, mask));
+		}
+		for (; i < count; ++i)
+		{
+			result[i] = ToBGRSSE(colors[i]);
+		}
+	}
+
+	void ToBGRSSE(const FLinearColor* colors, COLORREF* result, int count)
+	{
+		const __m128i mask = _mm_set1_epi32(0xFFFFFF);
+		int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i value0 = ScaleToByte(colors[i]);
+			__m128i value1 = ScaleToByte(colors[i + 1]);
+			__m128i value2 = ScaleToByte(colors[i + 2]);
+			__m128i value3 = ScaleToByte(colors[i + 3]);
+			__m128i packed = _mm_packus_epi16(_mm_packs_epi32(value0, value1), _mm_packs_epi32(value2, value3));
+			_mm_storeu_si128((__m128i*)(result + i), _mm_and_si128(packed, mask));
+		}
+		for (; i < count; ++i)
+		{
+			result[i] = ToBGRSSE(colors[i]);
+		}
+	}
+
+	void ToLinearColorAVX2(const COLORREF* colors, FLinearColor* result, int count)
+	{
+		const __m256 scale = _mm256_set1_ps(255.0f);
+		const __m256 one = _mm256_set1_ps(1.0f);
+		int i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			__m256i value = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(colors + i)));
+			__m256 linear = _mm256_div_ps(_mm256_cvtepi32_ps(value), scale);
+			_mm256_storeu_ps(&result[i].R, _mm256_blend_ps(linear, one, 0x88));
+		}
+		for (; i < count; ++i)
+		{
+			ToLinearColorSSE(colors[i], result[i]);
+		}
+	}
+
+	void ToLinearColorSSE(const COLORREF* colors, FLinearColor* result, int count)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128 scale = _mm_set1_ps(255.0f);
+		const __m128 rgb = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 alpha = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+		int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i value = _mm_loadu_si128((const __m128i*)(colors + i));
+			__m128i low = _mm_unpacklo_epi8(value, zero);
+			__m128i high = _mm_unpackhi_epi8(value, zero);
+			__m128i pixels[4] =
+			{
+				_mm_unpacklo_epi16(low, zero),
+				_mm_unpackhi_epi16(low, zero),
+				_mm_unpacklo_epi16(high, zero),
+				_mm_unpackhi_epi16(high, zero),
+			};
+			for (int j = 0; j < 4; ++j)
+			{
+				__m128 linear = _mm_div_ps(_mm_cvtepi32_ps(pixels[j]), scale);
+				_mm_storeu_ps(&result[i + j].R, _mm_or_ps(_mm_and_ps(linear, rgb), alpha));
+			}
+		}
+		for (; i < count; ++i)
+		{
+			ToLinearColorSSE(colors[i], result[i]);
+		}
+	}
+}
+
+int Color::ToBGR(const FLinearColor& color)
+{
+	return (int)ToBGRSSE(color);
+}
+
+FLinearColor Color::ToLinearColor(int color)
+{
+	FLinearColor result;
+	ToLinearColorSSE((COLORREF)color, result);
+	return result;
+}
+
+void Color::ToBGR(const FLinearColor* colors, COLORREF* result, int count)
+{
+	if (_sHasAVX2)
+	{
+		ToBGRAVX2(colors, result, count);
+	}
+	else
+	{
+		ToBGRSSE(colors, result, count);
+	}
+}
+
+void Color::ToLinearColor(const COLORREF* colors, FLinearColor* result, int count)
+{
+	if (_sHasAVX2)
+	{
+		ToLinearColorAVX2(colors, result, count);
+	}
+	else
+	{
+		ToLinearColorSSE(colors, result, count);
+	}
+}
+
+void Color::Multiply(COLORREF* colors, int count, float intensity)
+{
+	//8.8 fixed point, 256 keeps the color and larger weights brighten until the channel saturates
+	const int weight = FMath::Clamp(FMath::RoundToInt(intensity * 256.0f), 0, 0xFFFF);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i scale = _mm_set1_epi16((short)weight);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i value = _mm_loadu_si128((const __m128i*)(colors + i));
+		__m128i low = MultiplySaturate(_mm_unpacklo_epi8(value, zero), scale);
+		__m128i high = MultiplySaturate(_mm_unpackhi_epi8(value, zero), scale);
+		_mm_storeu_si128((__m128i*)(colors + i), _mm_packus_epi16(low, high));
+	}
+	for (; i < count; ++i)
+	{
+		int red = FMath::Min((GetRValue(colors[i]) * weight + 128) >> 8, 255);
+		int green = FMath::Min((GetGValue(colors[i]) * weight + 128) >> 8, 255);
+		int blue = FMath::Min((GetBValue(colors[i]) * weight + 128) >> 8, 255);
+		colors[i] = RGB(red, green, blue);
+	}
+}
+
+void Color::CopyNonZero(const COLORREF* source, COLORREF* target, int count)
+{
+	const __m128i mask = _mm_set1_epi32(0xFFFFFF);
+	const __m128i zero = _mm_setzero_si128();
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i value = _mm_loadu_si128((const __m128i*)(source + i));
+		__m128i keep = _mm_cmpeq_epi32(_mm_and_si128(value, mask), zero);
+		__m128i previous = _mm_loadu_si128((const __m128i*)(target + i));
+		_mm_storeu_si128((__m128i*)(target + i), _mm_or_si128(_mm_and_si128(keep, previous), _mm_andnot_si128(keep, value)));
+	}
+	for (; i < count; ++i)
+	{
+		if ((source[i] & 0xFFFFFF) != 0)
+		{
+			target[i] = source[i];
+		}
+	}
+}
+
+void Color::Blend(const COLORREF* from, const COLORREF* to, COLORREF* result, int count, float amount)
+{
+	//8.8 fixed point, the two weights add up to 256 so the sum fits 16 bits
+	const int weight = FMath::Clamp(FMath::RoundToInt(amount * 256.0f), 0, 256);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i toScale = _mm_set1_epi16((short)weight);
+	const __m128i fromScale = _mm_set1_epi16((short)(256 - weight));
+	const __m128i half = _mm_set1_epi16(128);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*)(from + i));
+		__m128i b = _mm_loadu_si128((const __m128i*)(to + i));
+		__m128i low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), fromScale), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), toScale));
+		__m128i high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), fromScale), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), toScale));
+		low = _mm_srli_epi16(_mm_add_epi16(low, half), 8);
+		high = _mm_srli_epi16(_mm_add_epi16(high, half), 8);
+		_mm_storeu_si128((__m128i*)(result + i), _mm_packus_epi16(low, high));
+	}
+	for (; i < count; ++i)
+	{
+		int red = (GetRValue(from[i]) * (256 - weight) + GetRValue(to[i]) * weight + 128) >> 8;
+		int green = (GetGValue(from[i]) * (256 - weight) + GetGValue(to[i]) * weight + 128) >> 8;
+		int blue = (GetBValue(from[i]) * (256 - weight) + GetBValue(to[i]) * weight + 128) >> 8;
+		result[i] = RGB(red, green, blue);
+	}
+}
+
+void Color::ExpandMask(const uint32* bits, COLORREF* mask, int count)
+{
+	const __m128i select = _mm_setr_epi32(1, 2, 4, 8);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		//a group of 4 cells never straddles a word
+		__m128i word = _mm_set1_epi32((int)(bits[i >> 5] >> (i & 31)));
+		_mm_storeu_si128((__m128i*)(mask + i), _mm_cmpeq_epi32(_mm_and_si128(word, select), select));
+	}
+	for (; i < count; ++i)
+	{
+		mask[i] = 0u - ((bits[i >> 5] >> (i & 31)) & 1u);
+	}
+}
+
+void Color::FillMasked(COLORREF* colors, const COLORREF* mask, int count, COLORREF color)
+{
+	const __m128i value = _mm_set1_epi32((int)color);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i select = _mm_loadu_si128((const __m128i*)(mask + i));
+		__m128i previous = _mm_loadu_si128((const __m128i*)(colors + i));
+		_mm_storeu_si128((__m128i*)(colors + i), Select(select, value, previous));
+	}
+	for (; i < count; ++i)
+	{
+		colors[i] = (color & mask[i]) | (colors[i] & ~mask[i]);
+	}
+}
+
+void Color::CopyMasked(const COLORREF* source, COLORREF* target, const COLORREF* mask, int count)
+{
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i select = _mm_loadu_si128((const __m128i*)(mask + i));
+		__m128i value = _mm_loadu_si128((const __m128i*)(source + i));
+		__m128i previous = _mm_loadu_si128((const __m128i*)(target + i));
+		_mm_storeu_si128((__m128i*)(target + i), Select(select, value, previous));
+	}
+	for (; i < count; ++i)
+	{
+		target[i] = (source[i] & mask[i]) | (target[i] & ~mask[i]);
+	}
+}
+
+void Color::CopyNonZeroMasked(const COLORREF* source, COLORREF* target, const COLORREF* mask, int count)
+{
+	const __m128i rgb = _mm_set1_epi32(0xFFFFFF);
+	const __m128i zero = _mm_setzero_si128();
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i value = _mm_loadu_si128((const __m128i*)(source + i));
+		//black source cells drop out of the select mask
+		__m128i black = _mm_cmpeq_epi32(_mm_and_si128(value, rgb), zero);
+		__m128i select = _mm_andnot_si128(black, _mm_loadu_si128((const __m128i*)(mask + i)));
+		__m128i previous = _mm_loadu_si128((const __m128i*)(target + i));
+		_mm_storeu_si128((__m128i*)(target + i), Select(select, value, previous));
+	}
+	for (; i < count; ++i)
+	{
+		if (mask[i] != 0 &&
+			(source[i] & 0xFFFFFF) != 0)
+		{
+			target[i] = source[i];
+		}
+	}
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
@@ -0,0 +1,147 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaDraw.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+#include <emmintrin.h>
+
+using namespace ChromaSDK;
+using namespace ChromaSDK::Draw;
+
+void Draw::FillSpan(COLORREF* colors, int count, COLORREF color)
+{
+	int i = 0;
+	const __m128i value = _mm_set1_epi32((int)color);
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_si128((__m128i*)(colors + i), value);
+	}
+	for (; i < count; ++i)
+	{
+		colors[i] = color;
+	}
+}
+
+void Draw::FillSpan(FLinearColor* colors, int count, const FLinearColor& color)
+{
+	const __m128 value = _mm_loadu_ps(&color.R);
+	for (int i = 0; i < count; ++i)
+	{
+		_mm_storeu_ps(&colors[i].R, value);
+	}
+}
+
+void Draw::GradientSpan(COLORREF* colors, int count, COLORREF startColor, COLORREF endColor)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+	if (count == 1)
+	{
+		colors[0] = startColor;
+		return;
+	}
+
+	//16.16 fixed point per channel, four pixels per step
+	const int red = GetRValue(startColor) << 16;
+	const int green = GetGValue(startColor) << 16;
+	const int blue = GetBValue(startColor) << 16;
+	const int stepRed = ((GetRValue(endColor) << 16) - red) / (count - 1);
+	const int stepGreen = ((GetGValue(endColor) << 16) - green) / (count - 1);
+	const int stepBlue = ((GetBValue(endColor) << 16) - blue) / (count - 1);
+
+	//accumulators start at lanes 0..3 and carry the rounding half
+	const __m128i mask = _mm_set1_epi32(0xFF);
+	__m128i accRed = _mm_set_epi32(red + stepRed * 3 + 0x8000, red + stepRed * 2 + 0x8000, red + stepRed + 0x8000, red + 0x8000);
+	__m128i accGreen = _mm_set_epi32(green + stepGreen * 3 + 0x8000, green + stepGreen * 2 + 0x8000, green + stepGreen + 0x8000, green + 0x8000);
+	__m128i accBlue = _mm_set_epi32(blue + stepBlue * 3 + 0x8000, blue + stepBlue * 2 + 0x8000, blue + stepBlue + 0x8000, blue + 0x8000);
+	const __m128i stepRed4 = _mm_set1_epi32(stepRed * 4);
+	const __m128i stepGreen4 = _mm_set1_epi32(stepGreen * 4);
+	const __m128i stepBlue4 = _mm_set1_epi32(stepBlue * 4);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i r = _mm_and_si128(_mm_srai_epi32(accRed, 16), mask);
+		__m128i g = _mm_and_si128(_mm_srai_epi32(accGreen, 16), mask);
+		__m128i b = _mm_and_si128(_mm_srai_epi32(accBlue, 16), mask);
+		__m128i bgr = _mm_or_si128(r, _mm_or_si128(_mm_slli_epi32(g, 8), _mm_slli_epi32(b, 16)));
+		_mm_storeu_si128((__m128i*)(colors + i), bgr);
+		accRed = _mm_add_epi32(accRed, stepRed4);
+		accGreen = _mm_add_epi32(accGreen, stepGreen4);
+		accBlue = _mm_add_epi32(accBlue, stepBlue4);
+	}
+	for (; i < count; ++i)
+	{
+		int r = ((red + stepRed * i + 0x8000) >> 16) & 0xFF;
+		int g = ((green + stepGreen * i + 0x8000) >> 16) & 0xFF;
+		int b = ((blue + stepBlue * i + 0x8000) >> 16) & 0xFF;
+		colors[i] = RGB(r, g, b);
+	}
+}
+
+void Draw::GradientSpan(FLinearColor* colors, int count, const FLinearColor& startColor, const FLinearColor& endColor)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+	if (count == 1)
+	{
+		colors[0] = startColor;
+		return;
+	}
+	const __m128 start = _mm_loadu_ps(&startColor.R);
+	const __m128 delta = _mm_sub_ps(_mm_loadu_ps(&endColor.R), start);
+	const float step = 1.0f / (count - 1);
+	for (int i = 0; i < count; ++i)
+	{
+		__m128 t = _mm_set1_ps(i * step);
+		_mm_storeu_ps(&colors[i].R, _mm_add_ps(start, _mm_mul_ps(delta, t)));
+	}
+}
+
+FPackedGrid Draw::MakeGrid(COLORREF* colors, int maxRow, int maxColumn)
+{
+	FPackedGrid grid;
+	grid.Colors = colors;
+	grid.MaxRow = maxRow;
+	grid.MaxColumn = maxColumn;
+	return grid;
+}
+
+FLinearGrid Draw::MakeGrid(TArray<FChromaSDKColors>& colors)
+{
+	FLinearGrid grid;
+	grid.Colors = &colors;
+	grid.MaxRow = colors.Num();
+	grid.MaxColumn = 0;
+	//ragged rows are clipped to the shortest row
+	for (int i = 0; i < colors.Num(); ++i)
+	{
+		int columns = colors[i].Colors.Num();
+		if (i == 0 ||
+			columns < grid.MaxColumn)
+		{
+			grid.MaxColumn = columns;
+		}
+	}
+	return grid;
+}
+
+FLinearStrip Draw::MakeStrip(TArray<FLinearColor>& colors)
+{
+	FLinearStrip strip;
+	strip.Colors = &colors;
+	strip.MaxRow = 1;
+	strip.MaxColumn = colors.Num();
+	return strip;
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
@@ -0,0 +1,111 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaEffectPlayer.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaThread.h"
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+using namespace ChromaSDK;
+using namespace std;
+
+ChromaEffectPlayer::ChromaEffectPlayer()
+{
+	_mTime = 0.0f;
+	_mCurrentFrame = 0;
+	_mShownFrame = -1;
+	_mIsPlaying = false;
+	_mCompleted = false;
+}
+
+void ChromaEffectPlayer::Play(const vector<RZEFFECTID>& effects, const vector<float>& times)
+{
+	//the worker must be done with the old frames before they change
+	Stop();
+	_mEffects = effects;
+	_mTimes = times;
+	_mCompleted = false;
+	_mIsPlaying = true;
+	ChromaThread::Instance()->AddPlayer(this);
+}
+
+void ChromaEffectPlayer::Stop()
+{
+	ChromaThread::Instance()->RemovePlayer(this);
+	_mIsPlaying = false;
+	_mTime = 0.0f;
+	_mCurrentFrame = 0;
+	_mShownFrame = -1;
+}
+
+bool ChromaEffectPlayer::IsPlaying()
+{
+	return _mIsPlaying;
+}
+
+bool ChromaEffectPlayer::TakeCompleted()
+{
+	return _mCompleted.exchange(false);
+}
+
+void ChromaEffectPlayer::AdvanceTime(float deltaTime)
+{
+	//the playback time scale applies on top of game time
+	if (_mIsPlaying)
+	{
+		_mTime = _mTime + deltaTime * ChromaThread::Instance()->GetTimeScale();
+	}
+}
+
+void ChromaEffectPlayer::Update()
+{
+	if (!_mIsPlaying)
+	{
+		return;
+	}
+
+	//the first frame shows on the first tick after play
+	if (_mShownFrame != _mCurrentFrame)
+	{
+		ShowFrame(_mCurrentFrame);
+		return;
+	}
+
+	//the owner's tick moves the clock, a paused game leaves it where it is
+	float nextTime = _mCurrentFrame < (int)_mTimes.size() ? _mTimes[_mCurrentFrame] : 0.033f;
+	if (nextTime < _mTime)
+	{
+		++_mCurrentFrame;
+		if (_mCurrentFrame < (int)_mEffects.size())
+		{
+			ShowFrame(_mCurrentFrame);
+		}
+		else
+		{
+			_mCurrentFrame = 0;
+			_mShownFrame = -1;
+			//publish completion before the owner can see playback end
+			_mCompleted = true;
+			_mIsPlaying = false;
+		}
+	}
+}
+
+void ChromaEffectPlayer::ShowFrame(int index)
+{
+	_mShownFrame = index;
+	if (index >= (int)_mEffects.size())
+	{
+		return;
+	}
+	RZRESULT result = FChromaSDKPluginModule::Get().ChromaSDKSetEffect(_mEffects[index]);
+	if (result != 0)
+	{
+		fprintf(stderr, "ChromaEffectPlayer: Failed to set effect!\r\n");
+	}
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
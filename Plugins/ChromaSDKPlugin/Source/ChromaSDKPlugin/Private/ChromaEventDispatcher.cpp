@@ -0,0 +1,84 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaEventDispatcher.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaThread.h"
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+using namespace ChromaSDK;
+using namespace std;
+
+void FChromaEventDispatcher::Bind(int animationId, const FString& animationName, const FDelegateChromaSDKAnimationEvent& onEvent)
+{
+	FEventHandler handler;
+	handler.AnimationName = animationName;
+	handler.OnEvent = onEvent;
+	lock_guard<mutex> guard(_mHandlerMutex);
+	_mHandlers.Add(animationId, handler);
+}
+
+void FChromaEventDispatcher::Unbind(int animationId)
+{
+	lock_guard<mutex> guard(_mHandlerMutex);
+	_mHandlers.Remove(animationId);
+}
+
+void FChromaEventDispatcher::UnbindName(const FString& animationName)
+{
+	lock_guard<mutex> guard(_mHandlerMutex);
+	for (auto it = _mHandlers.CreateIterator(); it; ++it)
+	{
+		if (it.Value().AnimationName == animationName)
+		{
+			it.RemoveCurrent();
+		}
+	}
+}
+
+void FChromaEventDispatcher::Tick(float DeltaTime)
+{
+	//always drain so events for unbound animations do not fill the queue
+	FChromaAnimationEvent event;
+	while (ChromaThread::Instance()->PopEvent(event))
+	{
+		//the handler may bind or unbind, run a copy outside the lock
+		FEventHandler handler;
+		{
+			lock_guard<mutex> guard(_mHandlerMutex);
+			const FEventHandler* found = _mHandlers.Find(event.AnimationId);
+			if (found == nullptr)
+			{
+				continue;
+			}
+			handler = *found;
+		}
+		handler.OnEvent.ExecuteIfBound(handler.AnimationName, event.Type);
+	}
+}
+
+bool FChromaEventDispatcher::IsTickable() const
+{
+	return true;
+}
+
+bool FChromaEventDispatcher::IsTickableInEditor() const
+{
+	return true;
+}
+
+bool FChromaEventDispatcher::IsTickableWhenPaused() const
+{
+	//file animations keep playing on the worker while the game is paused
+	return true;
+}
+
+TStatId FChromaEventDispatcher::GetStatId() const
+{
+	return TStatId();
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
@@ -0,0 +1,39 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaEventQueue.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+
+using namespace ChromaSDK;
+using namespace std;
+
+ChromaEventQueue::ChromaEventQueue()
+{
+	_mHead = 0;
+	_mTail = 0;
+}
+
+bool ChromaEventQueue::Push(const FChromaAnimationEvent& event)
+{
+	const unsigned int tail = _mTail.load(memory_order_relaxed);
+	//the counters run freely, the difference is the number of queued events
+	if (tail - _mHead.load(memory_order_acquire) >= CAPACITY)
+	{
+		return false;
+	}
+	_mEvents[tail % CAPACITY] = event;
+	//publish the slot after it is written
+	_mTail.store(tail + 1, memory_order_release);
+	return true;
+}
+
+bool ChromaEventQueue::Pop(FChromaAnimationEvent& event)
+{
+	const unsigned int head = _mHead.load(memory_order_relaxed);
+	if (head == _mTail.load(memory_order_acquire))
+	{
+		return false;
+	}
+	event = _mEvents[head % CAPACITY];
+	//hand the slot back after it is read
+	_mHead.store(head + 1, memory_order_release);
+	return true;
+}
@@ -0,0 +1,47 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaOfflineRenderer.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "ChromaThread.h"
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+using namespace ChromaSDK;
+using namespace std;
+
+ChromaOfflineRenderer::ChromaOfflineRenderer(float stepTime) :
+	_mTimeline(stepTime)
+{
+}
+
+void ChromaOfflineRenderer::AddEvent(float time, const function<void()>& action)
+{
+	_mTimeline.AddEvent(time, action);
+}
+
+void ChromaOfflineRenderer::Render(float duration)
+{
+	FChromaSDKPluginModule& module = FChromaSDKPluginModule::Get();
+	ChromaThread* thread = ChromaThread::Instance();
+	thread->SetHold(true);
+	module.SetRecorder(&_mRecorder);
+
+	_mTimeline.Run(duration, [&](float deltaTime)
+	{
+		thread->Tick(deltaTime);
+		_mRecorder.Capture(deltaTime);
+	});
+
+	module.SetRecorder(nullptr);
+	thread->SetHold(false);
+}
+
+int ChromaOfflineRenderer::Save(const char* basePath)
+{
+	return _mRecorder.Save(basePath);
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
@@ -0,0 +1,177 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaRecorder.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include <string>
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h"
+
+typedef unsigned char byte;
+#define ANIMATION_VERSION 1
+
+using namespace ChromaSDK;
+using namespace std;
+
+static const char* DEVICE_SUFFIXES[] = { "_ChromaLink", "_Headset", "_Keyboard", "_Keypad", "_Mouse", "_Mousepad" };
+
+ChromaRecorder::ChromaRecorder()
+{
+	_mNextEffectId = 0;
+	_mCapturedTime = 0.0f;
+	memset(_mShown, 0, sizeof(_mShown));
+	memset(_mShowing, 0, sizeof(_mShowing));
+}
+
+int ChromaRecorder::GetSize(EChromaSDKDeviceEnum device)
+{
+	switch (device)
+	{
+	case EChromaSDKDeviceEnum::DE_ChromaLink:
+		return ChromaLink::MAX_LEDS;
+	case EChromaSDKDeviceEnum::DE_Headset:
+		return Headset::MAX_LEDS;
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+		return Keyboard::MAX_ROW * Keyboard::MAX_COLUMN;
+	case EChromaSDKDeviceEnum::DE_Keypad:
+		return Keypad::MAX_ROW * Keypad::MAX_COLUMN;
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		return Mouse::MAX_ROW * Mouse::MAX_COLUMN;
+	default:
+		return Mousepad::MAX_LEDS;
+	}
+}
+
+RZRESULT ChromaRecorder::CreateEffect(EChromaSDKDeviceEnum device, const COLORREF* colors, RZEFFECTID* pEffectId)
+{
+	lock_guard<mutex> guard(_mMutex);
+	//no effect id applies the colors right away, like the SDK
+	if (pEffectId == nullptr)
+	{
+		Show(device, colors);
+		return RZRESULT_SUCCESS;
+	}
+	FRecordedEffect effect;
+	effect.Device = device;
+	effect.Colors.assign(colors, colors + GetSize(device));
+	memset(pEffectId, 0, sizeof(RZEFFECTID));
+	pEffectId->Data1 = ++_mNextEffectId;
+	_mEffects[pEffectId->Data1] = effect;
+	return RZRESULT_SUCCESS;
+}
+
+RZRESULT ChromaRecorder::SetEffect(RZEFFECTID effectId)
+{
+	lock_guard<mutex> guard(_mMutex);
+	auto it = _mEffects.find(effectId.Data1);
+	if (it == _mEffects.end())
+	{
+		return RZRESULT_NOT_FOUND;
+	}
+	Show(it->second.Device, it->second.Colors.data());
+	return RZRESULT_SUCCESS;
+}
+
+RZRESULT ChromaRecorder::DeleteEffect(RZEFFECTID effectId)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (_mEffects.erase(effectId.Data1) == 0)
+	{
+		return RZRESULT_NOT_FOUND;
+	}
+	return RZRESULT_SUCCESS;
+}
+
+void ChromaRecorder::Show(EChromaSDKDeviceEnum device, const COLORREF* colors)
+{
+	const int index = (int)device;
+	memcpy(_mShowing[index], colors, GetSize(device) * sizeof(COLORREF));
+	_mShown[index] = true;
+}
+
+void ChromaRecorder::Capture(float duration)
+{
+	lock_guard<mutex> guard(_mMutex);
+	for (int index = 0; index < DEVICE_COUNT; ++index)
+	{
+		if (!_mShown[index])
+		{
+			continue;
+		}
+		_mTracks[index].Capture(_mShowing[index], GetSize((EChromaSDKDeviceEnum)index), duration, _mCapturedTime);
+	}
+	_mCapturedTime += duration;
+}
+
+int ChromaRecorder::Save(const char* basePath)
+{
+	lock_guard<mutex> guard(_mMutex);
+	for (int index = 0; index < DEVICE_COUNT; ++index)
+	{
+		const ChromaCaptureTrack<COLORREF>& track = _mTracks[index];
+		if (track.IsEmpty())
+		{
+			continue;
+		}
+		const EChromaSDKDeviceEnum device = (EChromaSDKDeviceEnum)index;
+		const int size = GetSize(device);
+		string path = string(basePath) + DEVICE_SUFFIXES[index] + ".chroma";
+		FILE* stream = nullptr;
+		if (0 != fopen_s(&stream, path.c_str(), "wb") ||
+			stream == nullptr)
+		{
+			fprintf(stderr, "Save: Failed to open recording! %s\r\n", path.c_str());
+			return -1;
+		}
+
+		//same layout as a packed single device animation
+		int version = ANIMATION_VERSION;
+		byte deviceType = 0;
+		byte deviceId = 0;
+		switch (device)
+		{
+		case EChromaSDKDeviceEnum::DE_ChromaLink:
+			deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_1D;
+			deviceId = (byte)EChromaSDKDevice1DEnum::DE_ChromaLink;
+			break;
+		case EChromaSDKDeviceEnum::DE_Headset:
+			deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_1D;
+			deviceId = (byte)EChromaSDKDevice1DEnum::DE_Headset;
+			break;
+		case EChromaSDKDeviceEnum::DE_Mousepad:
+			deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_1D;
+			deviceId = (byte)EChromaSDKDevice1DEnum::DE_Mousepad;
+			break;
+		case EChromaSDKDeviceEnum::DE_Keyboard:
+			deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_2D;
+			deviceId = (byte)EChromaSDKDevice2DEnum::DE_Keyboard;
+			break;
+		case EChromaSDKDeviceEnum::DE_Keypad:
+			deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_2D;
+			deviceId = (byte)EChromaSDKDevice2DEnum::DE_Keypad;
+			break;
+		case EChromaSDKDeviceEnum::DE_Mouse:
+			deviceType = (byte)EChromaSDKDeviceTypeEnum::DE_2D;
+			deviceId = (byte)EChromaSDKDevice2DEnum::DE_Mouse;
+			break;
+		}
+		unsigned int frameCount = track.GetFrameCount();
+		fwrite(&version, sizeof(int), 1, stream);
+		fwrite(&deviceType, sizeof(byte), 1, stream);
+		fwrite(&deviceId, sizeof(byte), 1, stream);
+		fwrite(&frameCount, sizeof(unsigned int), 1, stream);
+		for (unsigned int frame = 0; frame < frameCount; ++frame)
+		{
+			float duration = track.GetDuration(frame);
+			fwrite(&duration, sizeof(float), 1, stream);
+			fwrite(track.GetColors(frame, size), sizeof(int), size, stream);
+		}
+		fflush(stream);
+		std::fclose(stream);
+	}
+	return 0;
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
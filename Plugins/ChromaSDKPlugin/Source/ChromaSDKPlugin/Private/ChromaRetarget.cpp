@@ -0,0 +1,176 @@
+#//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
+#include "ChromaRetarget.h"
+#include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
+#include "AnimationBase.h"
+#include "ChromaCanvas.h"
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+#include "AllowWindowsPlatformTypes.h" 
+
+using namespace ChromaSDK;
+using namespace std;
+
+namespace
+{
+	struct FTap
+	{
+		int Index;
+		float Weight;
+	};
+
+	// source taps and weights for each target index along one axis
+	void BuildTaps(int sourceSize, int targetSize, EChromaSDKRetargetKernel kernel, vector<vector<FTap>>& taps)
+	{
+		taps.assign(targetSize, vector<FTap>());
+		const float scale = (float)sourceSize / (float)targetSize;
+		for (int i = 0; i < targetSize; ++i)
+		{
+			vector<FTap>& list = taps[i];
+			if (kernel == EChromaSDKRetargetKernel::RK_Bilinear ||
+				scale <= 1.0f)
+			{
+				//sample the source at the target cell center, growing always interpolates
+				float center = (i + 0.5f) * scale - 0.5f;
+				center = FMath::Clamp(center, 0.0f, (float)(sourceSize - 1));
+				const int left = (int)center;
+				const int right = FMath::Min(left + 1, sourceSize - 1);
+				const float t = center - left;
+				FTap tap;
+				tap.Index = left;
+				tap.Weight = 1.0f - t;
+				list.push_back(tap);
+				if (right != left)
+				{
+					tap.Index = right;
+					tap.Weight = t;
+					list.push_back(tap);
+				}
+			}
+			else
+			{
+				//weight each source cell by how much of it the target cell covers
+				const float start = i * scale;
+				const float end = (i + 1) * scale;
+				for (int j = (int)start; j < sourceSize && j < end; ++j)
+				{
+					const float coverage = FMath::Min(end, (float)(j + 1)) - FMath::Max(start, (float)j);
+					if (coverage > 0.0f)
+					{
+						FTap tap;
+						tap.Index = j;
+						tap.Weight = coverage / scale;
+						list.push_back(tap);
+					}
+				}
+			}
+		}
+	}
+
+	inline int ToChannel(float value)
+	{
+		return FMath::Clamp((int)(value + 0.5f), 0, 255);
+	}
+}
+
+void Retarget::GetGridSize(EChromaSDKDeviceEnum device, int& maxRow, int& maxColumn)
+{
+	switch (device)
+	{
+	case EChromaSDKDeviceEnum::DE_ChromaLink:
+		maxRow = 1;
+		maxColumn = ChromaLink::MAX_LEDS;
+		break;
+	case EChromaSDKDeviceEnum::DE_Headset:
+		maxRow = 1;
+		maxColumn = Headset::MAX_LEDS;
+		break;
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+		maxRow = Keyboard::MAX_ROW;
+		maxColumn = Keyboard::MAX_COLUMN;
+		break;
+	case EChromaSDKDeviceEnum::DE_Keypad:
+		maxRow = Keypad::MAX_ROW;
+		maxColumn = Keypad::MAX_COLUMN;
+		break;
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		maxRow = Mouse::MAX_ROW;
+		maxColumn = Mouse::MAX_COLUMN;
+		break;
+	case EChromaSDKDeviceEnum::DE_Mousepad:
+	default:
+		maxRow = 1;
+		maxColumn = Mousepad::MAX_LEDS;
+		break;
+	}
+}
+
+EChromaSDKDeviceEnum Retarget::GetDevice(AnimationBase* animation)
+{
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		return ChromaCanvas::ToDevice((EChromaSDKDevice1DEnum)animation->GetDeviceId());
+	default:
+		return ChromaCanvas::ToDevice((EChromaSDKDevice2DEnum)animation->GetDeviceId());
+	}
+}
+
+void Retarget::Resample(const COLORREF* source, int sourceRows, int sourceColumns,
+	COLORREF* target, int targetRows, int targetColumns, EChromaSDKRetargetKernel kernel)
+{
+	vector<vector<FTap>> columnTaps;
+	vector<vector<FTap>> rowTaps;
+	BuildTaps(sourceColumns, targetColumns, kernel, columnTaps);
+	BuildTaps(sourceRows, targetRows, kernel, rowTaps);
+
+	//horizontal pass into float channels, one row of target columns per source row
+	vector<float> rows(sourceRows * targetColumns * 3);
+	for (int row = 0; row < sourceRows; ++row)
+	{
+		const COLORREF* sourceRow = source + row * sourceColumns;
+		float* result = rows.data() + row * targetColumns * 3;
+		for (int column = 0; column < targetColumns; ++column)
+		{
+			float red = 0.0f;
+			float green = 0.0f;
+			float blue = 0.0f;
+			const vector<FTap>& taps = columnTaps[column];
+			for (unsigned int i = 0; i < taps.size(); ++i)
+			{
+				const COLORREF color = sourceRow[taps[i].Index];
+				red += (color & 0xFF) * taps[i].Weight;
+				green += ((color >> 8) & 0xFF) * taps[i].Weight;
+				blue += ((color >> 16) & 0xFF) * taps[i].Weight;
+			}
+			result[column * 3] = red;
+			result[column * 3 + 1] = green;
+			result[column * 3 + 2] = blue;
+		}
+	}
+
+	//vertical pass back to packed BGR
+	for (int row = 0; row < targetRows; ++row)
+	{
+		const vector<FTap>& taps = rowTaps[row];
+		for (int column = 0; column < targetColumns; ++column)
+		{
+			float red = 0.0f;
+			float green = 0.0f;
+			float blue = 0.0f;
+			for (unsigned int i = 0; i < taps.size(); ++i)
+			{
+				const float* color = rows.data() + (taps[i].Index * targetColumns + column) * 3;
+				red += color[0] * taps[i].Weight;
+				green += color[1] * taps[i].Weight;
+				blue += color[2] * taps[i].Weight;
+			}
+			target[row * targetColumns + column] = RGB(ToChannel(red), ToChannel(green), ToChannel(blue));
+		}
+	}
+}
+
+#include "HideWindowsPlatformTypes.h"
+
+#endif
@@ -4,13 +4,22 @@
 #include "AnimationBase.h"
 #include "Animation1D.h"
 #include "Animation2D.h"
+#include "AnimationComposite.h"
+#include "AnimationInstance.h"
+#include "AnimationSequence.h"
+#include "AnimationStateMachine.h"
 #include "ChromaThread.h"
+#include "ChromaColor.h"
+#include "ChromaEventDispatcher.h"
+#include "ChromaRecorder.h"
+#include "ChromaRetarget.h"
 
 #define LOCTEXT_NAMESPACE "FChromaSDKPluginModule"
 
 #if PLATFORM_WINDOWS
 
 #include "AllowWindowsPlatformTypes.h" 
+#include <io.h>
 
 #ifdef _WIN64
 #define CHROMASDKDLL        _T("RzChromaSDK64.dll")
@@ -20,6 +29,8 @@
 
 typedef unsigned char byte;
 #define ANIMATION_VERSION 1
+#define ANIMATION_VERSION_PALETTE 2
+#define ANIMATION_VERSION_COMPOSITE 3
 
 using namespace ChromaSDK;
 using namespace ChromaSDK::ChromaLink;
@@ -30,6 +41,54 @@ using namespace ChromaSDK::Mouse;
 using namespace ChromaSDK::Mousepad;
 using namespace std;
 
+// palette and index bytes that follow the frame count in a version 2 file
+template<typename TIndexedFrame>
+bool ReadIndexedFrames(FILE* stream, int frameCount, int count, vector<COLORREF>& palette, vector<TIndexedFrame>& indexedFrames)
+{
+	int paletteSize = 0;
+	if (fread(&paletteSize, sizeof(int), 1, stream) != 1 ||
+		paletteSize <= 0 ||
+		paletteSize > MAX_PALETTE_SIZE)
+	{
+		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading palette size!"));
+		return false;
+	}
+	palette.resize(paletteSize);
+	if (fread(palette.data(), sizeof(int), paletteSize, stream) != paletteSize)
+	{
+		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading palette!"));
+		return false;
+	}
+	for (int index = 0; index < frameCount; ++index)
+	{
+		TIndexedFrame frame;
+		memset(frame.Indices, 0, sizeof(frame.Indices));
+
+		//duration
+		float duration = 0.0f;
+		if (fread(&duration, sizeof(float), 1, stream) != 1)
+		{
+			UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading duration!"));
+			return false;
+		}
+		if (duration < 0.1f)
+		{
+			duration = 0.1f;
+		}
+		frame.Duration = duration;
+
+		//indices
+		if (fread(frame.Indices, sizeof(uint8), count, stream) != count ||
+			!Palette::Validate(palette, frame, count))
+		{
+			UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading color index!"));
+			return false;
+		}
+		indexedFrames.push_back(frame);
+	}
+	return true;
+}
+
 bool FChromaSDKPluginModule::ValidateGetProcAddress(bool condition, FString methodName)
 {
 	if (condition)
@@ -51,11 +110,36 @@ void FChromaSDKPluginModule::StartupModule()
 
 #if PLATFORM_WINDOWS
 	_mInitialized = false;
+	_mRecorder = nullptr;
+	_mEventDispatcher = new FChromaEventDispatcher();
 	_mAnimationId = 0;
-	_mAnimationMapID.clear();
-	_mAnimations.clear();
-	_mPlayMap1D.clear();
-	_mPlayMap2D.clear();
+	_mAnimations.Clear();
+	for (int i = 0; i < PLAY_MAP_1D_SIZE; ++i)
+	{
+		_mPlayMap1D[i] = -1;
+	}
+	for (int i = 0; i < PLAY_MAP_2D_SIZE; ++i)
+	{
+		_mPlayMap2D[i] = -1;
+	}
+	for (int i = 0; i < PLAY_MAP_1D_SIZE; ++i)
+	{
+		_mShowCount1D[i] = 0;
+	}
+	for (int i = 0; i < PLAY_MAP_2D_SIZE; ++i)
+	{
+		_mShowCount2D[i] = 0;
+	}
+	_mInstanceId = 0;
+	_mInstances.clear();
+	_mRetargets.clear();
+	_mCompositeId = 0;
+	_mCompositeMapID.clear();
+	_mComposites.clear();
+	_mSequenceId = 0;
+	_mSequences.clear();
+	_mStateMachineId = 0;
+	_mStateMachines.clear();
 
 	_mLibraryChroma = LoadLibrary(CHROMASDKDLL);
 	if (_mLibraryChroma == NULL)
@@ -152,6 +236,9 @@ void FChromaSDKPluginModule::ShutdownModule()
 
 	UChromaSDKPluginBPLibrary::ChromaSDKUnInit();
 
+	delete _mEventDispatcher;
+	_mEventDispatcher = nullptr;
+
 	if (_mLibraryChroma)
 	{
 		FreeLibrary(_mLibraryChroma);
@@ -166,7 +253,9 @@ void FChromaSDKPluginModule::ShutdownModule()
 
 bool FChromaSDKPluginModule::IsInitialized()
 {
-	return _mInitialized;
+	//the recorder stands in for an initialized SDK
+	return _mInitialized ||
+		_mRecorder != nullptr;
 }
 
 int FChromaSDKPluginModule::ChromaSDKInit()
@@ -194,20 +283,51 @@ int FChromaSDKPluginModule::ChromaSDKUnInit()
 		return -1;
 	}
 
-	while (_mAnimations.size() > 0)
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+
+	while (_mStateMachines.size() > 0)
+	{
+		DestroyStateMachine(_mStateMachines.begin()->first);
+	}
+
+	while (_mSequences.size() > 0)
+	{
+		DestroySequence(_mSequences.begin()->first);
+	}
+
+	while (_mComposites.size() > 0)
+	{
+		CloseComposite(_mComposites.begin()->first);
+	}
+
+	shared_ptr<const FAnimationRegistry::FSnapshot> lookup = GetAnimationLookup();
+	for (auto it = lookup->Objects.begin(); it != lookup->Objects.end(); ++it)
 	{
-		int animationId = _mAnimations.begin()->first;
-		StopAnimation(animationId);
-		CloseAnimation(animationId);
+		StopAnimation(it->first);
+		CloseAnimation(it->first);
 	}
+	//the snapshot keeps the closed animations alive until it is released
+	lookup.reset();
+	//closed animations release their effects when they are deleted, do it before the SDK goes away
+	ChromaThread::Instance()->Reclaim(true);
 
 	int result = _mMethodUnInit();
 	_mInitialized = false;
 	_mAnimationId = 0;
-	_mAnimationMapID.clear();
-	_mAnimations.clear();
-	_mPlayMap1D.clear();
-	_mPlayMap2D.clear();
+	_mAnimations.Clear();
+	for (int i = 0; i < PLAY_MAP_1D_SIZE; ++i)
+	{
+		_mPlayMap1D[i] = -1;
+	}
+	for (int i = 0; i < PLAY_MAP_2D_SIZE; ++i)
+	{
+		_mPlayMap2D[i] = -1;
+	}
+	_mRetargets.clear();
+	_mCompositeId = 0;
+	_mCompositeMapID.clear();
+	_mSequenceId = 0;
+	_mStateMachineId = 0;
 	//UE_LOG(LogTemp, Log, TEXT("ChromaSDKPlugin [UNINITIALIZED] result=%d"), result);
 	return result;
 }
@@ -220,7 +340,13 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateEffect(RZDEVICEID deviceId, Chro
 		return -1;
 	}
 
-	return _mMethodCreateEffect(deviceId, effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateEffect(deviceId, effect, pParam, pEffectId);
+	//a null effect id shows the effect right away
+	if (pEffectId == nullptr)
+	{
+		MarkAllShown();
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKCreateChromaLinkEffect(ChromaSDK::ChromaLink::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId)
@@ -231,7 +357,12 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateChromaLinkEffect(ChromaSDK::Chro
 		return -1;
 	}
 
-	return _mMethodCreateChromaLinkEffect(effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateChromaLinkEffect(effect, pParam, pEffectId);
+	if (pEffectId == nullptr)
+	{
+		MarkShown((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_ChromaLink);
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKCreateHeadsetEffect(ChromaSDK::Headset::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId)
@@ -242,7 +373,12 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateHeadsetEffect(ChromaSDK::Headset
 		return -1;
 	}
 
-	return _mMethodCreateHeadsetEffect(effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateHeadsetEffect(effect, pParam, pEffectId);
+	if (pEffectId == nullptr)
+	{
+		MarkShown((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Headset);
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKCreateKeyboardEffect(ChromaSDK::Keyboard::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId)
@@ -253,7 +389,12 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateKeyboardEffect(ChromaSDK::Keyboa
 		return -1;
 	}
 
-	return _mMethodCreateKeyboardEffect(effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateKeyboardEffect(effect, pParam, pEffectId);
+	if (pEffectId == nullptr)
+	{
+		MarkShown((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keyboard);
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKCreateKeypadEffect(ChromaSDK::Keypad::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId)
@@ -264,7 +405,12 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateKeypadEffect(ChromaSDK::Keypad::
 		return -1;
 	}
 
-	return _mMethodCreateKeypadEffect(effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateKeypadEffect(effect, pParam, pEffectId);
+	if (pEffectId == nullptr)
+	{
+		MarkShown((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keypad);
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKCreateMouseEffect(ChromaSDK::Mouse::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId)
@@ -275,7 +421,12 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateMouseEffect(ChromaSDK::Mouse::EF
 		return -1;
 	}
 
-	return _mMethodCreateMouseEffect(effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateMouseEffect(effect, pParam, pEffectId);
+	if (pEffectId == nullptr)
+	{
+		MarkShown((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Mouse);
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKCreateMousepadEffect(ChromaSDK::Mousepad::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId)
@@ -286,11 +437,62 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKCreateMousepadEffect(ChromaSDK::Mousep
 		return -1;
 	}
 
-	return _mMethodCreateMousepadEffect(effect, pParam, pEffectId);
+	RZRESULT result = _mMethodCreateMousepadEffect(effect, pParam, pEffectId);
+	if (pEffectId == nullptr)
+	{
+		MarkShown((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Mousepad);
+	}
+	return result;
 }
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKSetEffect(RZEFFECTID effectId)
 {
+	RZRESULT result = ApplyEffect(effectId);
+	MarkAllShown();
+	return result;
+}
+
+RZRESULT FChromaSDKPluginModule::ChromaSDKSetEffect(RZEFFECTID effectId, int deviceType, int device, unsigned int* pShowCount)
+{
+	RZRESULT result = ApplyEffect(effectId);
+	unsigned int showCount = MarkShown(deviceType, device);
+	if (pShowCount != nullptr)
+	{
+		*pShowCount = showCount;
+	}
+	return result;
+}
+
+unsigned int FChromaSDKPluginModule::GetShowCount(int deviceType, int device)
+{
+	atomic<unsigned int>* slot = GetShowCountSlot(deviceType, device);
+	return slot != nullptr ? slot->load() : 0;
+}
+
+unsigned int FChromaSDKPluginModule::MarkShown(int deviceType, int device)
+{
+	atomic<unsigned int>* slot = GetShowCountSlot(deviceType, device);
+	return slot != nullptr ? ++(*slot) : 0;
+}
+
+void FChromaSDKPluginModule::MarkAllShown()
+{
+	for (int i = 0; i < PLAY_MAP_1D_SIZE; ++i)
+	{
+		++_mShowCount1D[i];
+	}
+	for (int i = 0; i < PLAY_MAP_2D_SIZE; ++i)
+	{
+		++_mShowCount2D[i];
+	}
+}
+
+RZRESULT FChromaSDKPluginModule::ApplyEffect(RZEFFECTID effectId)
+{
+	if (_mRecorder != nullptr)
+	{
+		return _mRecorder->SetEffect(effectId);
+	}
 	if (_mMethodSetEffect == nullptr)
 	{
 		UE_LOG(LogTemp, Error, TEXT("ChromaSDKPlugin SetEffect method is not set!"));
@@ -302,6 +504,10 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKSetEffect(RZEFFECTID effectId)
 
 RZRESULT FChromaSDKPluginModule::ChromaSDKDeleteEffect(RZEFFECTID effectId)
 {
+	if (_mRecorder != nullptr)
+	{
+		return _mRecorder->DeleteEffect(effectId);
+	}
 	if (_mMethodDeleteEffect == nullptr)
 	{
 		UE_LOG(LogTemp, Error, TEXT("ChromaSDKPlugin DeleteEffect method is not set!"));
@@ -311,20 +517,86 @@ RZRESULT FChromaSDKPluginModule::ChromaSDKDeleteEffect(RZEFFECTID effectId)
 	return _mMethodDeleteEffect(effectId);
 }
 
+RZRESULT FChromaSDKPluginModule::CreateEffectCustom1D(const EChromaSDKDevice1DEnum& device, const COLORREF* colors, RZEFFECTID* pEffectId)
+{
+	if (_mRecorder != nullptr)
+	{
+		RZRESULT result = _mRecorder->CreateEffect(ChromaCanvas::ToDevice(device), colors, pEffectId);
+		if (pEffectId == nullptr)
+		{
+			MarkShown((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)device);
+		}
+		return result;
+	}
+	switch (device)
+	{
+	case EChromaSDKDevice1DEnum::DE_ChromaLink:
+		{
+			ChromaLink::CUSTOM_EFFECT_TYPE pParam = {};
+			memcpy(pParam.Color, colors, sizeof(pParam.Color));
+			return ChromaSDKCreateChromaLinkEffect(ChromaLink::CHROMA_CUSTOM, &pParam, pEffectId);
+		}
+	case EChromaSDKDevice1DEnum::DE_Headset:
+		{
+			Headset::CUSTOM_EFFECT_TYPE pParam = {};
+			memcpy(pParam.Color, colors, sizeof(pParam.Color));
+			return ChromaSDKCreateHeadsetEffect(Headset::CHROMA_CUSTOM, &pParam, pEffectId);
+		}
+	case EChromaSDKDevice1DEnum::DE_Mousepad:
+		{
+			Mousepad::CUSTOM_EFFECT_TYPE pParam = {};
+			memcpy(pParam.Color, colors, sizeof(pParam.Color));
+			return ChromaSDKCreateMousepadEffect(Mousepad::CHROMA_CUSTOM, &pParam, pEffectId);
+		}
+	}
+	UE_LOG(LogTemp, Error, TEXT("ChromaSDKPlugin::CreateEffectCustom1D Unsupported device used!"));
+	return -1;
+}
+
+RZRESULT FChromaSDKPluginModule::CreateEffectCustom2D(const EChromaSDKDevice2DEnum& device, const COLORREF* colors, RZEFFECTID* pEffectId)
+{
+	if (_mRecorder != nullptr)
+	{
+		RZRESULT result = _mRecorder->CreateEffect(ChromaCanvas::ToDevice(device), colors, pEffectId);
+		if (pEffectId == nullptr)
+		{
+			MarkShown((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)device);
+		}
+		return result;
+	}
+	switch (device)
+	{
+	case EChromaSDKDevice2DEnum::DE_Keyboard:
+		{
+			Keyboard::CUSTOM_EFFECT_TYPE pParam = {};
+			memcpy(pParam.Color, colors, sizeof(pParam.Color));
+			return ChromaSDKCreateKeyboardEffect(Keyboard::CHROMA_CUSTOM, &pParam, pEffectId);
+		}
+	case EChromaSDKDevice2DEnum::DE_Keypad:
+		{
+			Keypad::CUSTOM_EFFECT_TYPE pParam = {};
+			memcpy(pParam.Color, colors, sizeof(pParam.Color));
+			return ChromaSDKCreateKeypadEffect(Keypad::CHROMA_CUSTOM, &pParam, pEffectId);
+		}
+	case EChromaSDKDevice2DEnum::DE_Mouse:
+		{
+			Mouse::CUSTOM_EFFECT_TYPE2 pParam = {};
+			memcpy(pParam.Color, colors, sizeof(pParam.Color));
+			return ChromaSDKCreateMouseEffect(Mouse::CHROMA_CUSTOM2, &pParam, pEffectId);
+		}
+	}
+	UE_LOG(LogTemp, Error, TEXT("ChromaSDKPlugin::CreateEffectCustom2D Unsupported device used!"));
+	return -1;
+}
+
 int FChromaSDKPluginModule::ToBGR(const FLinearColor& color)
 {
-	int red = color.R * 255;
-	int green = color.G * 255;
-	int blue = color.B * 255;
-	return RGB(red, green, blue);
+	return Color::ToBGR(color);
 }
 
 FLinearColor FChromaSDKPluginModule::ToLinearColor(int color)
 {
-	float red = GetRValue(color) / 255.0f;
-	float green = GetGValue(color) / 255.0f;
-	float blue = GetBValue(color) / 255.0f;
-	return FLinearColor(red, green, blue, 1.0f);
+	return Color::ToLinearColor(color);
 }
 
 int FChromaSDKPluginModule::GetMaxLeds(const EChromaSDKDevice1DEnum& device)
@@ -376,20 +648,10 @@ int FChromaSDKPluginModule::GetMaxColumn(const EChromaSDKDevice2DEnum& device)
 	return result;
 }
 
-int FChromaSDKPluginModule::OpenAnimation(const char* path)
+AnimationBase* FChromaSDKPluginModule::ReadAnimation(FILE* stream)
 {
 	AnimationBase* animation = nullptr;
 
-	//UE_LOG(LogTemp, Log, TEXT("OpenAnimation: %s"), path);
-
-	FILE* stream = nullptr;
-	if (0 != fopen_s(&stream, path, "rb") ||
-		stream == nullptr)
-	{
-		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Failed to open animation! %s"), *FString(UTF8_TO_TCHAR(path)));
-		return -1;
-	}
-
 	long read = 0;
 	long expectedRead = 1;
 	long expectedSize = sizeof(byte);
@@ -401,14 +663,13 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 	if (read != expectedRead)
 	{
 		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Failed to read version!"));
-		std::fclose(stream);
-		return -1;
+		return nullptr;
 	}
-	if (version != ANIMATION_VERSION)
+	if (version != ANIMATION_VERSION &&
+		version != ANIMATION_VERSION_PALETTE)
 	{
 		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Unexpected Version!"));
-		std::fclose(stream);
-		return -1;
+		return nullptr;
 	}
 
 	//UE_LOG(LogTemp, Log, TEXT("OpenAnimation: Version: %d"), version);
@@ -423,8 +684,7 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 	if (read != expectedRead)
 	{
 		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Unexpected DeviceType!"));
-		std::fclose(stream);
-		return -1;
+		return nullptr;
 	}
 
 	//device
@@ -438,8 +698,7 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 		break;
 	default:
 		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Unexpected DeviceType!"));
-		std::fclose(stream);
-		return -1;
+		return nullptr;
 	}
 
 	switch ((EChromaSDKDeviceTypeEnum)deviceType)
@@ -449,8 +708,7 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 		if (read != expectedRead)
 		{
 			UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Unexpected Device!"));
-			std::fclose(stream);
-			return -1;
+			return nullptr;
 		}
 		else
 		{
@@ -482,15 +740,25 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 			{
 				UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading frame count!"));
 				delete animation1D;
-				std::fclose(stream);
-				return -1;
+				return nullptr;
+			}
+			else if (version == ANIMATION_VERSION_PALETTE)
+			{
+				vector<COLORREF> palette;
+				vector<FChromaIndexedFrame1D> indexedFrames;
+				if (!ReadIndexedFrames(stream, frameCount, animation1D->GetColorCount(), palette, indexedFrames))
+				{
+					delete animation1D;
+					return nullptr;
+				}
+				animation1D->SetIndexedFrames(palette, indexedFrames);
 			}
 			else
 			{
-				vector<FChromaSDKColorFrame1D>& frames = animation1D->GetFrames();
+				vector<FChromaFrame1D>& frames = animation1D->GetFrames();
 				for (int index = 0; index < frameCount; ++index)
 				{
-					FChromaSDKColorFrame1D frame = FChromaSDKColorFrame1D();
+					FChromaFrame1D frame = FChromaFrame1D();
 					int maxLeds = GetMaxLeds((EChromaSDKDevice1DEnum)device);
 
 					//duration
@@ -501,8 +769,7 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 					{
 						UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading duration!"));
 						delete animation1D;
-						std::fclose(stream);
-						return -1;
+						return nullptr;
 					}
 					else
 					{
@@ -512,23 +779,14 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 						}
 						frame.Duration = duration;
 
-						// colors
+						// colors, the file is already packed BGR
 						expectedSize = sizeof(int);
-						for (int i = 0; i < maxLeds; ++i)
+						read = fread(frame.Colors, expectedSize, maxLeds, stream);
+						if (read != maxLeds)
 						{
-							int color = 0;
-							read = fread(&color, expectedSize, 1, stream);
-							if (read != expectedRead)
-							{
-								UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading color!"));
-								delete animation1D;
-								std::fclose(stream);
-								return -1;
-							}
-							else
-							{
-								frame.Colors.Add(FChromaSDKPluginModule::ToLinearColor(color));
-							}
+							UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading color!"));
+							delete animation1D;
+							return nullptr;
 						}
 						if (index == 0)
 						{
@@ -540,6 +798,8 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 						}
 					}
 				}
+				// keep the smaller palette encoding when the frames fit in one
+				animation1D->IndexFrames();
 			}
 		}
 		break;
@@ -548,8 +808,7 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 		if (read != expectedRead)
 		{
 			UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Unexpected Device!"));
-			std::fclose(stream);
-			return -1;
+			return nullptr;
 		}
 		else
 		{
@@ -581,15 +840,25 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 			{
 				UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading frame count!"));
 				delete animation2D;
-				std::fclose(stream);
-				return -1;
+				return nullptr;
+			}
+			else if (version == ANIMATION_VERSION_PALETTE)
+			{
+				vector<COLORREF> palette;
+				vector<FChromaIndexedFrame2D> indexedFrames;
+				if (!ReadIndexedFrames(stream, frameCount, animation2D->GetColorCount(), palette, indexedFrames))
+				{
+					delete animation2D;
+					return nullptr;
+				}
+				animation2D->SetIndexedFrames(palette, indexedFrames);
 			}
 			else
 			{
-				vector<FChromaSDKColorFrame2D>& frames = animation2D->GetFrames();
+				vector<FChromaFrame2D>& frames = animation2D->GetFrames();
 				for (int index = 0; index < frameCount; ++index)
 				{
-					FChromaSDKColorFrame2D frame = FChromaSDKColorFrame2D();
+					FChromaFrame2D frame = FChromaFrame2D();
 					int maxRow = GetMaxRow((EChromaSDKDevice2DEnum)device);
 					int maxColumn = GetMaxColumn((EChromaSDKDevice2DEnum)device);
 
@@ -601,8 +870,7 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 					{
 						UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading duration!"));
 						delete animation2D;
-						std::fclose(stream);
-						return -1;
+						return nullptr;
 					}
 					else
 					{
@@ -614,26 +882,12 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 
 						// colors
 						expectedSize = sizeof(int);
-						for (int i = 0; i < maxRow; ++i)
+						read = fread(frame.Colors, expectedSize, maxRow * maxColumn, stream);
+						if (read != maxRow * maxColumn)
 						{
-							FChromaSDKColors row = FChromaSDKColors();
-							for (int j = 0; j < maxColumn; ++j)
-							{
-								int color = 0;
-								read = fread(&color, expectedSize, 1, stream);
-								if (read != expectedRead)
-								{
-									UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading color!"));
-									delete animation2D;
-									std::fclose(stream);
-									return -1;
-								}
-								else
-								{
-									row.Colors.Add(FChromaSDKPluginModule::ToLinearColor(color));
-								}
-							}
-							frame.Colors.Add(row);
+							UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Error detected reading color!"));
+							delete animation2D;
+							return nullptr;
 						}
 						if (index == 0)
 						{
@@ -645,11 +899,30 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 						}
 					}
 				}
+				// keep whichever encoding is smallest for the frames
+				animation2D->CompactFrames();
 			}
 		}
 		break;
 	}
 
+	return animation;
+}
+
+int FChromaSDKPluginModule::OpenAnimation(const char* path)
+{
+	//UE_LOG(LogTemp, Log, TEXT("OpenAnimation: %s"), path);
+
+	FILE* stream = nullptr;
+	if (0 != fopen_s(&stream, path, "rb") ||
+		stream == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("OpenAnimation: Failed to open animation! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return -1;
+	}
+
+	AnimationBase* animation = ReadAnimation(stream);
+
 	std::fclose(stream);
 
 	if (animation == nullptr)
@@ -660,35 +933,78 @@ int FChromaSDKPluginModule::OpenAnimation(const char* path)
 
 	//UE_LOG(LogTemp, Log, TEXT("OpenAnimation: Loaded %s"), *FString(UTF8_TO_TCHAR(path)));
 	animation->SetName(path);
-	int id = _mAnimationId;
-	_mAnimations[id] = animation;
-	++_mAnimationId;
-	_mAnimationMapID[path] = id;
-	return id;
+	return RegisterAnimation(_mAnimationId++, animation, path);
+}
+
+int FChromaSDKPluginModule::RegisterAnimation(int animationId, AnimationBase* animation, const char* name)
+{
+	//stored before publishing so the worker never sees a registered animation without its id
+	animation->SetAnimationId(animationId);
+	return _mAnimations.Register(animationId, animation, name);
+}
+
+void FRetireAnimation::operator()(AnimationBase* animation) const
+{
+	//the worker may be inside a tick that read the animation, delete once it has left
+	ChromaThread::Instance()->Retire(animation);
+}
+
+shared_ptr<const FChromaSDKPluginModule::FAnimationRegistry::FSnapshot> FChromaSDKPluginModule::GetAnimationLookup()
+{
+	return _mAnimations.GetSnapshot();
 }
 
 int FChromaSDKPluginModule::CloseAnimation(int animationId)
 {
 	try
 	{
-		if (_mAnimations.find(animationId) != _mAnimations.end())
+		shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+		//only the caller that removes the id tears the animation down
+		if (animation == nullptr ||
+			!_mAnimations.Unregister(animationId))
+		{
+			return -1;
+		}
+		//after this no play can hand the animation back to ChromaThread
+		animation->Close();
+		animation->Stop();
 		{
-			AnimationBase* animation = _mAnimations[animationId];
-			if (animation == nullptr)
+			lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+			//instances can't outlive the frames they play
+			vector<int> instanceIds;
+			for (auto it = _mInstances.begin(); it != _mInstances.end(); ++it)
+			{
+				if (it->second->GetAnimation() == animation.get())
+				{
+					instanceIds.push_back(it->first);
+				}
+			}
+			for (unsigned int i = 0; i < instanceIds.size(); ++i)
+			{
+				DestroyInstance(instanceIds[i]);
+			}
+			CloseRetargets(animationId);
+			for (auto it = _mComposites.begin(); it != _mComposites.end(); ++it)
+			{
+				it->second->RemoveTrack(animation.get());
+			}
+			for (auto it = _mSequences.begin(); it != _mSequences.end(); ++it)
 			{
-				UE_LOG(LogTemp, Error, TEXT("CloseAnimation: Animation is null! id=%d"), animationId);
-				return -1;
+				it->second->RemoveAnimation(animation.get());
 			}
-			animation->Stop();
-			string animationName = animation->GetName();
-			if (_mAnimationMapID.find(animationName) != _mAnimationMapID.end())
+			for (auto it = _mStateMachines.begin(); it != _mStateMachines.end(); ++it)
 			{
-				_mAnimationMapID.erase(animationName);
+				it->second->RemoveAnimation(animation.get());
 			}
-			delete _mAnimations[animationId];
-			_mAnimations.erase(animationId);
-			return animationId;
 		}
+		if (_mEventDispatcher != nullptr)
+		{
+			_mEventDispatcher->Unbind(animationId);
+		}
+		//retired once the last reader lets go, usually right here
+		animation.reset();
+		ChromaThread::Instance()->Reclaim(false);
+		return animationId;
 	}
 	catch (exception)
 	{
@@ -708,6 +1024,11 @@ int FChromaSDKPluginModule::CloseAnimationName(const char* path)
 	return CloseAnimation(animationId);
 }
 
+FChromaEventDispatcher* FChromaSDKPluginModule::GetEventDispatcher()
+{
+	return _mEventDispatcher;
+}
+
 int FChromaSDKPluginModule::GetAnimationIdFromInstance(AnimationBase* animation)
 {
 	if (animation == nullptr)
@@ -715,32 +1036,22 @@ int FChromaSDKPluginModule::GetAnimationIdFromInstance(AnimationBase* animation)
 		UE_LOG(LogTemp, Error, TEXT("GetAnimationIdFromInstance: Invalid animation!"));
 		return -1;
 	}
-	for (int index = 0; index < _mAnimations.size(); ++index)
-	{
-		if (_mAnimations[index] == animation)
-		{
-			return index;
-		}
-	}
-	return -1;
+	return animation->GetAnimationId();
 }
 
-AnimationBase* FChromaSDKPluginModule::GetAnimationInstance(int animationId)
+shared_ptr<AnimationBase> FChromaSDKPluginModule::GetAnimationInstance(int animationId)
 {
-	if (_mAnimations.find(animationId) != _mAnimations.end())
-	{
-		return _mAnimations[animationId];
-	}
-	return nullptr;
+	return _mAnimations.Find(animationId);
 }
 
 int FChromaSDKPluginModule::GetAnimationFrameCount(int animationId)
 {
-	AnimationBase* animation = GetAnimationInstance(animationId);
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
 	if (nullptr == animation)
 	{
 		return -1;
 	}
+	lock_guard<mutex> guard(animation->GetFrameMutex());
 	return animation->GetFrameCount();
 }
 
@@ -757,8 +1068,13 @@ int FChromaSDKPluginModule::GetAnimationFrameCountName(const char* path)
 
 void FChromaSDKPluginModule::SetKeyColor(int animationId, int frameId, int rzkey, COLORREF color)
 {
-	StopAnimation(animationId);
-	AnimationBase* animation = GetAnimationInstance(animationId);
+	if (HIBYTE(rzkey) >= Keyboard::MAX_ROW ||
+		LOBYTE(rzkey) >= Keyboard::MAX_COLUMN)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SetKeyColor: Key is out of range! %d"), rzkey);
+		return;
+	}
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
 	if (nullptr == animation)
 	{
 		return;
@@ -766,13 +1082,15 @@ void FChromaSDKPluginModule::SetKeyColor(int animationId, int frameId, int rzkey
 	if (animation->GetDeviceType() == EChromaSDKDeviceTypeEnum::DE_2D &&
 		animation->GetDeviceId() == (int)EChromaSDKDevice2DEnum::DE_Keyboard)
 	{
-		Animation2D* animation2D = (Animation2D*)(animation);
-		vector<FChromaSDKColorFrame2D>& frames = animation2D->GetFrames();
+		Animation2D* animation2D = (Animation2D*)(animation.get());
+		lock_guard<mutex> guard(animation2D->GetFrameMutex());
+		vector<FChromaFrame2D>& frames = animation2D->GetFrames();
 		if (frameId >= 0 &&
 			frameId < frames.size())
 		{
-			FChromaSDKColorFrame2D& frame = frames[frameId];
-			frame.Colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)] = ToLinearColor(color);
+			FChromaFrame2D& frame = frames[frameId];
+			frame.Colors[HIBYTE(rzkey) * Keyboard::MAX_COLUMN + LOBYTE(rzkey)] = color;
+			animation2D->MarkFrameChanged(frameId);
 		}
 	}
 }
@@ -790,8 +1108,13 @@ void FChromaSDKPluginModule::SetKeyColorName(const char* path, int frameId, int
 
 COLORREF FChromaSDKPluginModule::GetKeyColor(int animationId, int frameId, int rzkey)
 {
-	StopAnimation(animationId);
-	AnimationBase* animation = GetAnimationInstance(animationId);
+	if (HIBYTE(rzkey) >= Keyboard::MAX_ROW ||
+		LOBYTE(rzkey) >= Keyboard::MAX_COLUMN)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GetKeyColor: Key is out of range! %d"), rzkey);
+		return 0;
+	}
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
 	if (nullptr == animation)
 	{
 		return 0;
@@ -799,14 +1122,14 @@ COLORREF FChromaSDKPluginModule::GetKeyColor(int animationId, int frameId, int r
 	if (animation->GetDeviceType() == EChromaSDKDeviceTypeEnum::DE_2D &&
 		animation->GetDeviceId() == (int)EChromaSDKDevice2DEnum::DE_Keyboard)
 	{
-		Animation2D* animation2D = (Animation2D*)(animation);
-		vector<FChromaSDKColorFrame2D>& frames = animation2D->GetFrames();
+		Animation2D* animation2D = (Animation2D*)(animation.get());
+		lock_guard<mutex> guard(animation2D->GetFrameMutex());
 		if (frameId >= 0 &&
-			frameId < frames.size())
+			frameId < animation2D->GetFrameCount())
 		{
-			FChromaSDKColorFrame2D& frame = frames[frameId];
-			FLinearColor& color = frame.Colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)];
-			return ToBGR(color);
+			COLORREF scratch[MAX_COLORS_2D];
+			const COLORREF* colors = animation2D->GetFrameColors(frameId, scratch);
+			return colors[HIBYTE(rzkey) * Keyboard::MAX_COLUMN + LOBYTE(rzkey)];
 		}
 	}
 	return 0;
@@ -826,13 +1149,18 @@ COLORREF FChromaSDKPluginModule::GetKeyColorName(const char* path, int frameId,
 
 void FChromaSDKPluginModule::CopyKeyColor(int sourceAnimationId, int targetAnimationId, int frameId, int rzkey)
 {
-	StopAnimation(targetAnimationId);
-	AnimationBase* sourceAnimation = GetAnimationInstance(sourceAnimationId);
+	if (HIBYTE(rzkey) >= Keyboard::MAX_ROW ||
+		LOBYTE(rzkey) >= Keyboard::MAX_COLUMN)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyKeyColor: Key is out of range! %d"), rzkey);
+		return;
+	}
+	shared_ptr<AnimationBase> sourceAnimation = GetAnimationInstance(sourceAnimationId);
 	if (nullptr == sourceAnimation)
 	{
 		return;
 	}
-	AnimationBase* targetAnimation = GetAnimationInstance(targetAnimationId);
+	shared_ptr<AnimationBase> targetAnimation = GetAnimationInstance(targetAnimationId);
 	if (nullptr == targetAnimation)
 	{
 		return;
@@ -851,11 +1179,12 @@ void FChromaSDKPluginModule::CopyKeyColor(int sourceAnimationId, int targetAnima
 	{
 		return;
 	}
-	Animation2D* sourceAnimation2D = (Animation2D*)(sourceAnimation);
-	Animation2D* targetAnimation2D = (Animation2D*)(targetAnimation);
-	vector<FChromaSDKColorFrame2D>& sourceFrames = sourceAnimation2D->GetFrames();
-	vector<FChromaSDKColorFrame2D>& targetFrames = targetAnimation2D->GetFrames();
-	if (sourceFrames.size() == 0)
+	Animation2D* sourceAnimation2D = (Animation2D*)(sourceAnimation.get());
+	Animation2D* targetAnimation2D = (Animation2D*)(targetAnimation.get());
+	AnimationPairLock guard(targetAnimation2D, sourceAnimation2D);
+	const int sourceFrameCount = sourceAnimation2D->GetFrameCount();
+	vector<FChromaFrame2D>& targetFrames = targetAnimation2D->GetFrames();
+	if (sourceFrameCount == 0)
 	{
 		return;
 	}
@@ -865,9 +1194,12 @@ void FChromaSDKPluginModule::CopyKeyColor(int sourceAnimationId, int targetAnima
 	}
 	if (frameId < targetFrames.size())
 	{
-		FChromaSDKColorFrame2D& sourceFrame = sourceFrames[frameId % sourceFrames.size()];
-		FChromaSDKColorFrame2D& targetFrame = targetFrames[frameId];
-		targetFrame.Colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)] = sourceFrame.Colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)];
+		COLORREF scratch[MAX_COLORS_2D];
+		const COLORREF* sourceColors = sourceAnimation2D->GetFrameColors(frameId % sourceFrameCount, scratch);
+		FChromaFrame2D& targetFrame = targetFrames[frameId];
+		const int index = HIBYTE(rzkey) * Keyboard::MAX_COLUMN + LOBYTE(rzkey);
+		targetFrame.Colors[index] = sourceColors[index];
+		targetAnimation2D->MarkFrameChanged(frameId);
 	}
 }
 
@@ -891,13 +1223,18 @@ void FChromaSDKPluginModule::CopyKeyColorName(const char* sourceAnimation, const
 
 void FChromaSDKPluginModule::CopyNonZeroKeyColor(int sourceAnimationId, int targetAnimationId, int frameId, int rzkey)
 {
-	StopAnimation(targetAnimationId);
-	AnimationBase* sourceAnimation = GetAnimationInstance(sourceAnimationId);
+	if (HIBYTE(rzkey) >= Keyboard::MAX_ROW ||
+		LOBYTE(rzkey) >= Keyboard::MAX_COLUMN)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroKeyColor: Key is out of range! %d"), rzkey);
+		return;
+	}
+	shared_ptr<AnimationBase> sourceAnimation = GetAnimationInstance(sourceAnimationId);
 	if (nullptr == sourceAnimation)
 	{
 		return;
 	}
-	AnimationBase* targetAnimation = GetAnimationInstance(targetAnimationId);
+	shared_ptr<AnimationBase> targetAnimation = GetAnimationInstance(targetAnimationId);
 	if (nullptr == targetAnimation)
 	{
 		return;
@@ -916,11 +1253,12 @@ void FChromaSDKPluginModule::CopyNonZeroKeyColor(int sourceAnimationId, int targ
 	{
 		return;
 	}
-	Animation2D* sourceAnimation2D = (Animation2D*)(sourceAnimation);
-	Animation2D* targetAnimation2D = (Animation2D*)(targetAnimation);
-	vector<FChromaSDKColorFrame2D>& sourceFrames = sourceAnimation2D->GetFrames();
-	vector<FChromaSDKColorFrame2D>& targetFrames = targetAnimation2D->GetFrames();
-	if (sourceFrames.size() == 0)
+	Animation2D* sourceAnimation2D = (Animation2D*)(sourceAnimation.get());
+	Animation2D* targetAnimation2D = (Animation2D*)(targetAnimation.get());
+	AnimationPairLock guard(targetAnimation2D, sourceAnimation2D);
+	const int sourceFrameCount = sourceAnimation2D->GetFrameCount();
+	vector<FChromaFrame2D>& targetFrames = targetAnimation2D->GetFrames();
+	if (sourceFrameCount == 0)
 	{
 		return;
 	}
@@ -930,12 +1268,15 @@ void FChromaSDKPluginModule::CopyNonZeroKeyColor(int sourceAnimationId, int targ
 	}
 	if (frameId < targetFrames.size())
 	{
-		FChromaSDKColorFrame2D& sourceFrame = sourceFrames[frameId % sourceFrames.size()];
-		FChromaSDKColorFrame2D& targetFrame = targetFrames[frameId];
-		FLinearColor& color = sourceFrame.Colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)];
-		if (ToBGR(color) != 0)
+		COLORREF scratch[MAX_COLORS_2D];
+		const COLORREF* sourceColors = sourceAnimation2D->GetFrameColors(frameId % sourceFrameCount, scratch);
+		FChromaFrame2D& targetFrame = targetFrames[frameId];
+		const int index = HIBYTE(rzkey) * Keyboard::MAX_COLUMN + LOBYTE(rzkey);
+		COLORREF color = sourceColors[index];
+		if (color != 0)
 		{
-			targetFrame.Colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)] = color;
+			targetFrame.Colors[index] = color;
+			targetAnimation2D->MarkFrameChanged(frameId);
 		}
 	}
 }
@@ -957,85 +1298,1524 @@ void FChromaSDKPluginModule::CopyNonZeroKeyColorName(const char* sourceAnimation
 	CopyNonZeroKeyColor(sourceAnimationId, targetAnimationId, frameId, rzkey);
 }
 
-
-void FChromaSDKPluginModule::LoadAnimation(int animationId)
+shared_ptr<Animation2D> FChromaSDKPluginModule::GetKeyboardAnimation(int animationId)
 {
-	AnimationBase* animation = GetAnimationInstance(animationId);
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
 	if (nullptr == animation)
 	{
-		return;
+		return nullptr;
 	}
-	animation->Load();
+	if (animation->GetDeviceType() != EChromaSDKDeviceTypeEnum::DE_2D ||
+		animation->GetDeviceId() != (int)EChromaSDKDevice2DEnum::DE_Keyboard)
+	{
+		return nullptr;
+	}
+	return static_pointer_cast<Animation2D>(animation);
 }
 
-void FChromaSDKPluginModule::LoadAnimationName(const char* path)
+void FChromaSDKPluginModule::SetKeySetColorFrames(int animationId, int startFrame, int endFrame, const FChromaSDKKeySet& keySet, COLORREF color)
 {
-	int animationId = GetAnimation(path);
-	if (animationId < 0)
+	if (keySet.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("LoadName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
 		return;
 	}
-	LoadAnimation(animationId);
-}
-
-void FChromaSDKPluginModule::UnloadAnimation(int animationId)
-{
-	AnimationBase* animation = GetAnimationInstance(animationId);
-	if (nullptr == animation)
+	shared_ptr<Animation2D> animation2D = GetKeyboardAnimation(animationId);
+	if (nullptr == animation2D)
 	{
 		return;
 	}
-	animation->Stop();
-	animation->Unload();
-}
-
-void FChromaSDKPluginModule::UnloadAnimationName(const char* path)
-{
-	int animationId = GetAnimation(path);
-	if (animationId < 0)
+	lock_guard<mutex> guard(animation2D->GetFrameMutex());
+	vector<FChromaFrame2D>& frames = animation2D->GetFrames();
+	if (startFrame < 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UnloadName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
 		return;
 	}
-	UnloadAnimation(animationId);
-}
+	if (endFrame > (int)frames.size())
+	{
+		endFrame = frames.size();
+	}
+	// one select mask cell per grid cell, expanded once for all frames
+	COLORREF mask[MAX_COLORS_2D];
+	Color::ExpandMask(keySet.Mask, mask, MAX_COLORS_2D);
+	for (int frameId = startFrame; frameId < endFrame; ++frameId)
+	{
+		Color::FillMasked(frames[frameId].Colors, mask, MAX_COLORS_2D, color);
+	}
+	animation2D->MarkFramesChanged(startFrame, endFrame);
+}
+
+void FChromaSDKPluginModule::CopyKeySetColorFrames(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame, const FChromaSDKKeySet& keySet, bool nonZero)
+{
+	if (keySet.IsEmpty())
+	{
+		return;
+	}
+	shared_ptr<Animation2D> sourceAnimation2D = GetKeyboardAnimation(sourceAnimationId);
+	if (nullptr == sourceAnimation2D)
+	{
+		return;
+	}
+	shared_ptr<Animation2D> targetAnimation2D = GetKeyboardAnimation(targetAnimationId);
+	if (nullptr == targetAnimation2D)
+	{
+		return;
+	}
+	AnimationPairLock guard(targetAnimation2D.get(), sourceAnimation2D.get());
+	vector<FChromaFrame2D>& targetFrames = targetAnimation2D->GetFrames();
+	const int sourceFrameCount = sourceAnimation2D->GetFrameCount();
+	if (sourceFrameCount == 0 ||
+		startFrame < 0)
+	{
+		return;
+	}
+	if (endFrame > (int)targetFrames.size())
+	{
+		endFrame = targetFrames.size();
+	}
+	COLORREF mask[MAX_COLORS_2D];
+	Color::ExpandMask(keySet.Mask, mask, MAX_COLORS_2D);
+	// a palette source decodes each frame once
+	COLORREF scratch[MAX_COLORS_2D];
+	for (int frameId = startFrame; frameId < endFrame; ++frameId)
+	{
+		const COLORREF* sourceFrame = sourceAnimation2D->GetFrameColors(frameId % sourceFrameCount, scratch);
+		if (nonZero)
+		{
+			Color::CopyNonZeroMasked(sourceFrame, targetFrames[frameId].Colors, mask, MAX_COLORS_2D);
+		}
+		else
+		{
+			Color::CopyMasked(sourceFrame, targetFrames[frameId].Colors, mask, MAX_COLORS_2D);
+		}
+	}
+	targetAnimation2D->MarkFramesChanged(startFrame, endFrame);
+}
+
+void FChromaSDKPluginModule::SetKeySetColor(int animationId, int frameId, const FChromaSDKKeySet& keySet, COLORREF color)
+{
+	SetKeySetColorFrames(animationId, frameId, frameId + 1, keySet, color);
+}
+
+void FChromaSDKPluginModule::SetKeySetColorName(const char* path, int frameId, const FChromaSDKKeySet& keySet, COLORREF color)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SetKeySetColorName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	SetKeySetColor(animationId, frameId, keySet, color);
+}
+
+void FChromaSDKPluginModule::SetKeySetColorAllFrames(int animationId, const FChromaSDKKeySet& keySet, COLORREF color)
+{
+	SetKeySetColorFrames(animationId, 0, MAX_int32, keySet, color);
+}
+
+void FChromaSDKPluginModule::SetKeySetColorAllFramesName(const char* path, const FChromaSDKKeySet& keySet, COLORREF color)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SetKeySetColorAllFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	SetKeySetColorAllFrames(animationId, keySet, color);
+}
+
+void FChromaSDKPluginModule::CopyKeySetColor(int sourceAnimationId, int targetAnimationId, int frameId, const FChromaSDKKeySet& keySet)
+{
+	CopyKeySetColorFrames(sourceAnimationId, targetAnimationId, frameId, frameId + 1, keySet, false);
+}
+
+void FChromaSDKPluginModule::CopyKeySetColorName(const char* sourceAnimation, const char* targetAnimation, int frameId, const FChromaSDKKeySet& keySet)
+{
+	int sourceAnimationId = GetAnimation(sourceAnimation);
+	if (sourceAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyKeySetColorName: Source Animation not found! %s"), *FString(UTF8_TO_TCHAR(sourceAnimation)));
+		return;
+	}
+	int targetAnimationId = GetAnimation(targetAnimation);
+	if (targetAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyKeySetColorName: Target Animation not found! %s"), *FString(UTF8_TO_TCHAR(targetAnimation)));
+		return;
+	}
+	CopyKeySetColor(sourceAnimationId, targetAnimationId, frameId, keySet);
+}
+
+void FChromaSDKPluginModule::CopyKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet)
+{
+	CopyKeySetColorFrames(sourceAnimationId, targetAnimationId, 0, MAX_int32, keySet, false);
+}
+
+void FChromaSDKPluginModule::CopyKeySetColorAllFramesName(const char* sourceAnimation, const char* targetAnimation, const FChromaSDKKeySet& keySet)
+{
+	int sourceAnimationId = GetAnimation(sourceAnimation);
+	if (sourceAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyKeySetColorAllFramesName: Source Animation not found! %s"), *FString(UTF8_TO_TCHAR(sourceAnimation)));
+		return;
+	}
+	int targetAnimationId = GetAnimation(targetAnimation);
+	if (targetAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyKeySetColorAllFramesName: Target Animation not found! %s"), *FString(UTF8_TO_TCHAR(targetAnimation)));
+		return;
+	}
+	CopyKeySetColorAllFrames(sourceAnimationId, targetAnimationId, keySet);
+}
+
+void FChromaSDKPluginModule::CopyNonZeroKeySetColor(int sourceAnimationId, int targetAnimationId, int frameId, const FChromaSDKKeySet& keySet)
+{
+	CopyKeySetColorFrames(sourceAnimationId, targetAnimationId, frameId, frameId + 1, keySet, true);
+}
+
+void FChromaSDKPluginModule::CopyNonZeroKeySetColorName(const char* sourceAnimation, const char* targetAnimation, int frameId, const FChromaSDKKeySet& keySet)
+{
+	int sourceAnimationId = GetAnimation(sourceAnimation);
+	if (sourceAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroKeySetColorName: Source Animation not found! %s"), *FString(UTF8_TO_TCHAR(sourceAnimation)));
+		return;
+	}
+	int targetAnimationId = GetAnimation(targetAnimation);
+	if (targetAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroKeySetColorName: Target Animation not found! %s"), *FString(UTF8_TO_TCHAR(targetAnimation)));
+		return;
+	}
+	CopyNonZeroKeySetColor(sourceAnimationId, targetAnimationId, frameId, keySet);
+}
+
+void FChromaSDKPluginModule::CopyNonZeroKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet)
+{
+	CopyKeySetColorFrames(sourceAnimationId, targetAnimationId, 0, MAX_int32, keySet, true);
+}
+
+void FChromaSDKPluginModule::CopyNonZeroKeySetColorAllFramesName(const char* sourceAnimation, const char* targetAnimation, const FChromaSDKKeySet& keySet)
+{
+	int sourceAnimationId = GetAnimation(sourceAnimation);
+	if (sourceAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroKeySetColorAllFramesName: Source Animation not found! %s"), *FString(UTF8_TO_TCHAR(sourceAnimation)));
+		return;
+	}
+	int targetAnimationId = GetAnimation(targetAnimation);
+	if (targetAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroKeySetColorAllFramesName: Target Animation not found! %s"), *FString(UTF8_TO_TCHAR(targetAnimation)));
+		return;
+	}
+	CopyNonZeroKeySetColorAllFrames(sourceAnimationId, targetAnimationId, keySet);
+}
+
+void FChromaSDKPluginModule::FillFrames(int animationId, int startFrame, int endFrame, COLORREF color)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->FillFrames(startFrame, endFrame, color);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->FillFrames(startFrame, endFrame, color);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::FillFramesName(const char* path, int startFrame, int endFrame, COLORREF color)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FillFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	FillFrames(animationId, startFrame, endFrame, color);
+}
+
+void FChromaSDKPluginModule::MultiplyFrames(int animationId, int startFrame, int endFrame, float intensity)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->MultiplyFrames(startFrame, endFrame, intensity);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->MultiplyFrames(startFrame, endFrame, intensity);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::MultiplyFramesName(const char* path, int startFrame, int endFrame, float intensity)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("MultiplyFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	MultiplyFrames(animationId, startFrame, endFrame, intensity);
+}
+
+void FChromaSDKPluginModule::ShiftFrames(int animationId, int startFrame, int endFrame, int rowOffset, int columnOffset)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->ShiftFrames(startFrame, endFrame, columnOffset);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->ShiftFrames(startFrame, endFrame, rowOffset, columnOffset);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::ShiftFramesName(const char* path, int startFrame, int endFrame, int rowOffset, int columnOffset)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ShiftFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	ShiftFrames(animationId, startFrame, endFrame, rowOffset, columnOffset);
+}
+
+void FChromaSDKPluginModule::ReverseFrames(int animationId, int startFrame, int endFrame)
+{
+	StopAnimation(animationId);
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->ReverseFrames(startFrame, endFrame);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->ReverseFrames(startFrame, endFrame);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::ReverseFramesName(const char* path, int startFrame, int endFrame)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ReverseFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	ReverseFrames(animationId, startFrame, endFrame);
+}
+
+void FChromaSDKPluginModule::DuplicateFrames(int animationId, int startFrame, int endFrame)
+{
+	StopAnimation(animationId);
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->DuplicateFrames(startFrame, endFrame);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->DuplicateFrames(startFrame, endFrame);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::DuplicateFramesName(const char* path, int startFrame, int endFrame)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DuplicateFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	DuplicateFrames(animationId, startFrame, endFrame);
+}
+
+void FChromaSDKPluginModule::TrimFrames(int animationId, int startFrame, int endFrame)
+{
+	StopAnimation(animationId);
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->TrimFrames(startFrame, endFrame);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->TrimFrames(startFrame, endFrame);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::TrimFramesName(const char* path, int startFrame, int endFrame)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("TrimFramesName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	TrimFrames(animationId, startFrame, endFrame);
+}
+
+void FChromaSDKPluginModule::ReplaceColor(int animationId, COLORREF color, COLORREF newColor)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		((Animation1D*)animation.get())->ReplaceColor(color, newColor);
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		((Animation2D*)animation.get())->ReplaceColor(color, newColor);
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::ReplaceColorName(const char* path, COLORREF color, COLORREF newColor)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ReplaceColorName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	ReplaceColor(animationId, color, newColor);
+}
+
+void FChromaSDKPluginModule::CopyFramesRegion(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns)
+{
+	shared_ptr<AnimationBase> sourceAnimation = GetAnimationInstance(sourceAnimationId);
+	if (nullptr == sourceAnimation)
+	{
+		return;
+	}
+	shared_ptr<AnimationBase> targetAnimation = GetAnimationInstance(targetAnimationId);
+	if (nullptr == targetAnimation)
+	{
+		return;
+	}
+	if (sourceAnimation->GetDeviceType() != targetAnimation->GetDeviceType())
+	{
+		return;
+	}
+	switch (targetAnimation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		{
+			Animation1D* sourceAnimation1D = (Animation1D*)(sourceAnimation.get());
+			((Animation1D*)targetAnimation.get())->CopyRegion(sourceAnimation1D, startFrame, endFrame, startColumn, columns);
+		}
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		{
+			Animation2D* sourceAnimation2D = (Animation2D*)(sourceAnimation.get());
+			((Animation2D*)targetAnimation.get())->CopyRegion(sourceAnimation2D, startFrame, endFrame, startRow, startColumn, rows, columns);
+		}
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::CopyFramesRegionName(const char* sourceAnimation, const char* targetAnimation, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns)
+{
+	int sourceAnimationId = GetAnimation(sourceAnimation);
+	if (sourceAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyFramesRegionName: Source Animation not found! %s"), *FString(UTF8_TO_TCHAR(sourceAnimation)));
+		return;
+	}
+	int targetAnimationId = GetAnimation(targetAnimation);
+	if (targetAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyFramesRegionName: Target Animation not found! %s"), *FString(UTF8_TO_TCHAR(targetAnimation)));
+		return;
+	}
+	CopyFramesRegion(sourceAnimationId, targetAnimationId, startFrame, endFrame, startRow, startColumn, rows, columns);
+}
+
+void FChromaSDKPluginModule::CopyNonZeroFrames(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame)
+{
+	shared_ptr<AnimationBase> sourceAnimation = GetAnimationInstance(sourceAnimationId);
+	if (nullptr == sourceAnimation)
+	{
+		return;
+	}
+	shared_ptr<AnimationBase> targetAnimation = GetAnimationInstance(targetAnimationId);
+	if (nullptr == targetAnimation)
+	{
+		return;
+	}
+	if (sourceAnimation->GetDeviceType() != targetAnimation->GetDeviceType())
+	{
+		return;
+	}
+	switch (targetAnimation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		{
+			Animation1D* sourceAnimation1D = (Animation1D*)(sourceAnimation.get());
+			((Animation1D*)targetAnimation.get())->CopyNonZeroFrames(sourceAnimation1D, startFrame, endFrame);
+		}
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		{
+			Animation2D* sourceAnimation2D = (Animation2D*)(sourceAnimation.get());
+			((Animation2D*)targetAnimation.get())->CopyNonZeroFrames(sourceAnimation2D, startFrame, endFrame);
+		}
+		break;
+	}
+}
+
+void FChromaSDKPluginModule::CopyNonZeroFramesName(const char* sourceAnimation, const char* targetAnimation, int startFrame, int endFrame)
+{
+	int sourceAnimationId = GetAnimation(sourceAnimation);
+	if (sourceAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroFramesName: Source Animation not found! %s"), *FString(UTF8_TO_TCHAR(sourceAnimation)));
+		return;
+	}
+	int targetAnimationId = GetAnimation(targetAnimation);
+	if (targetAnimationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CopyNonZeroFramesName: Target Animation not found! %s"), *FString(UTF8_TO_TCHAR(targetAnimation)));
+		return;
+	}
+	CopyNonZeroFrames(sourceAnimationId, targetAnimationId, startFrame, endFrame);
+}
+
+
+void FChromaSDKPluginModule::LoadAnimation(int animationId)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	animation->Load();
+}
+
+void FChromaSDKPluginModule::LoadAnimationName(const char* path)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LoadName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	LoadAnimation(animationId);
+}
+
+void FChromaSDKPluginModule::UnloadAnimation(int animationId)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return;
+	}
+	animation->Stop();
+	animation->Unload();
+}
+
+void FChromaSDKPluginModule::SetRecorder(ChromaRecorder* recorder)
+{
+	if (_mRecorder == recorder)
+	{
+		return;
+	}
+	//effects belong to the backend that created them
+	shared_ptr<const FAnimationRegistry::FSnapshot> lookup = GetAnimationLookup();
+	for (auto it = lookup->Objects.begin(); it != lookup->Objects.end(); ++it)
+	{
+		UnloadAnimation(it->first);
+	}
+	_mRecorder = recorder;
+}
+
+void FChromaSDKPluginModule::UnloadAnimationName(const char* path)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UnloadName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	UnloadAnimation(animationId);
+}
+
+int FChromaSDKPluginModule::GetAnimation(const char* path)
+{
+	shared_ptr<const FAnimationRegistry::FSnapshot> lookup = GetAnimationLookup();
+	auto it = lookup->Names.find(path);
+	if (it != lookup->Names.end())
+	{
+		return it->second;
+	}
+	return OpenAnimation(path);
+}
+
+const char* FChromaSDKPluginModule::GetAnimationName(int animationId)
+{
+	if (animationId < 0)
+	{
+		return "";
+	}
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation == nullptr)
+	{
+		return "";
+	}
+	return animation->GetName().c_str();
+}
+
+int FChromaSDKPluginModule::DuplicateAnimation(int animationId)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return -1;
+	}
+	AnimationBase* duplicate = nullptr;
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		{
+			Animation1D* duplicate1D = new Animation1D();
+			duplicate1D->ShareFrames((Animation1D*)animation.get());
+			duplicate = duplicate1D;
+		}
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		{
+			Animation2D* duplicate2D = new Animation2D();
+			duplicate2D->ShareFrames((Animation2D*)animation.get());
+			duplicate = duplicate2D;
+		}
+		break;
+	}
+	if (duplicate == nullptr)
+	{
+		return -1;
+	}
+	int id = _mAnimationId++;
+	//duplicates are not in the name map, so the name only needs to be unique for display
+	duplicate->SetName(animation->GetName() + "#" + to_string(id));
+	return RegisterAnimation(id, duplicate, nullptr);
+}
+
+int FChromaSDKPluginModule::DuplicateAnimationName(const char* path)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DuplicateAnimationName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return -1;
+	}
+	return DuplicateAnimation(animationId);
+}
+
+AnimationInstance* FChromaSDKPluginModule::GetInstance(int instanceId)
+{
+	if (_mInstances.find(instanceId) != _mInstances.end())
+	{
+		return _mInstances[instanceId];
+	}
+	return nullptr;
+}
+
+int FChromaSDKPluginModule::CreateInstance(int animationId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		return -1;
+	}
+	if (animation->IsClosed())
+	{
+		return -1;
+	}
+	AnimationInstance* instance = new AnimationInstance(animation.get());
+	int id = _mInstanceId;
+	_mInstances[id] = instance;
+	++_mInstanceId;
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->AddInstance(instance);
+	}
+	return id;
+}
+
+int FChromaSDKPluginModule::CreateInstanceName(const char* path)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CreateInstanceName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return -1;
+	}
+	return CreateInstance(animationId);
+}
+
+void FChromaSDKPluginModule::DestroyInstance(int instanceId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance)
+	{
+		return;
+	}
+	if (ChromaThread::Instance())
+	{
+		ChromaThread::Instance()->RemoveInstance(instance);
+	}
+	_mInstances.erase(instanceId);
+	delete instance;
+}
+
+AnimationSequence* FChromaSDKPluginModule::GetSequence(int sequenceId)
+{
+	if (_mSequences.find(sequenceId) != _mSequences.end())
+	{
+		return _mSequences[sequenceId];
+	}
+	return nullptr;
+}
+
+int FChromaSDKPluginModule::CreateSequence()
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = new AnimationSequence();
+	int id = _mSequenceId;
+	_mSequences[id] = sequence;
+	++_mSequenceId;
+	return id;
+}
+
+void FChromaSDKPluginModule::DestroySequence(int sequenceId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = GetSequence(sequenceId);
+	if (nullptr == sequence)
+	{
+		return;
+	}
+	sequence->Stop();
+	_mSequences.erase(sequenceId);
+	delete sequence;
+}
+
+int FChromaSDKPluginModule::AddSequenceItem(int sequenceId, int animationId, int loopCount)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = GetSequence(sequenceId);
+	if (nullptr == sequence)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddSequenceItem: Sequence not found! id=%d"), sequenceId);
+		return -1;
+	}
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddSequenceItem: Animation not found! id=%d"), animationId);
+		return -1;
+	}
+	if (animation->IsClosed())
+	{
+		return -1;
+	}
+	return sequence->AddItem(animation.get(), loopCount);
+}
+
+int FChromaSDKPluginModule::AddSequenceItemName(int sequenceId, const char* path, int loopCount)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddSequenceItemName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return -1;
+	}
+	return AddSequenceItem(sequenceId, animationId, loopCount);
+}
+
+void FChromaSDKPluginModule::ClearSequence(int sequenceId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = GetSequence(sequenceId);
+	if (nullptr == sequence)
+	{
+		return;
+	}
+	sequence->Clear();
+}
+
+void FChromaSDKPluginModule::PlaySequence(int sequenceId, bool loop)
+{
+	if (!IsInitialized())
+	{
+		ChromaSDKInit();
+	}
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = GetSequence(sequenceId);
+	if (nullptr == sequence)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlaySequence: Sequence not found! id=%d"), sequenceId);
+		return;
+	}
+	//the sequence drives its items, nothing else plays them or their devices
+	vector<AnimationBase*> animations = sequence->GetAnimations();
+	for (unsigned int i = 0; i < animations.size(); ++i)
+	{
+		AnimationBase* animation = animations[i];
+		StopAnimationType(animation->GetDeviceTypeId(), animation->GetDeviceId());
+		animation->Stop();
+	}
+	sequence->Play(loop);
+}
+
+void FChromaSDKPluginModule::StopSequence(int sequenceId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = GetSequence(sequenceId);
+	if (nullptr == sequence)
+	{
+		return;
+	}
+	sequence->Stop();
+}
+
+bool FChromaSDKPluginModule::IsSequencePlaying(int sequenceId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationSequence* sequence = GetSequence(sequenceId);
+	if (nullptr == sequence)
+	{
+		return false;
+	}
+	return sequence->IsPlaying();
+}
+
+AnimationStateMachine* FChromaSDKPluginModule::GetStateMachine(int stateMachineId)
+{
+	if (_mStateMachines.find(stateMachineId) != _mStateMachines.end())
+	{
+		return _mStateMachines[stateMachineId];
+	}
+	return nullptr;
+}
+
+int FChromaSDKPluginModule::CreateStateMachine()
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = new AnimationStateMachine();
+	int id = _mStateMachineId;
+	_mStateMachines[id] = stateMachine;
+	++_mStateMachineId;
+	return id;
+}
+
+void FChromaSDKPluginModule::DestroyStateMachine(int stateMachineId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		return;
+	}
+	stateMachine->Stop();
+	_mStateMachines.erase(stateMachineId);
+	delete stateMachine;
+}
+
+int FChromaSDKPluginModule::AddStateMachineState(int stateMachineId, bool loop)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineState: State machine not found! id=%d"), stateMachineId);
+		return -1;
+	}
+	return stateMachine->AddState(loop);
+}
+
+bool FChromaSDKPluginModule::AddStateMachineAnimation(int stateMachineId, int state, int animationId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineAnimation: State machine not found! id=%d"), stateMachineId);
+		return false;
+	}
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (nullptr == animation)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineAnimation: Animation not found! id=%d"), animationId);
+		return false;
+	}
+	if (animation->IsClosed())
+	{
+		return false;
+	}
+	if (!stateMachine->AddStateAnimation(state, animation.get()))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineAnimation: The state is missing or already has an animation for the device! state=%d"), state);
+		return false;
+	}
+	return true;
+}
+
+bool FChromaSDKPluginModule::AddStateMachineAnimationName(int stateMachineId, int state, const char* path)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineAnimationName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return false;
+	}
+	return AddStateMachineAnimation(stateMachineId, state, animationId);
+}
+
+int FChromaSDKPluginModule::AddStateMachineTransition(int stateMachineId, int fromState, int toState, int parameter, int compare, float value, float blendTime, int transition)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineTransition: State machine not found! id=%d"), stateMachineId);
+		return -1;
+	}
+	int result = stateMachine->AddTransition(fromState, toState, parameter, (EChromaSDKCompareEnum)compare, value, blendTime, (EChromaSDKTransitionEnum)transition);
+	if (result < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddStateMachineTransition: Invalid transition! from=%d to=%d parameter=%d"), fromState, toState, parameter);
+	}
+	return result;
+}
+
+void FChromaSDKPluginModule::SetStateMachineParameter(int stateMachineId, int parameter, float value)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		return;
+	}
+	stateMachine->SetParameter(parameter, value);
+}
+
+int FChromaSDKPluginModule::GetStateMachineState(int stateMachineId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine ||
+		!stateMachine->IsPlaying())
+	{
+		return -1;
+	}
+	return stateMachine->GetCurrentState();
+}
+
+void FChromaSDKPluginModule::PlayStateMachine(int stateMachineId, int state)
+{
+	if (!IsInitialized())
+	{
+		ChromaSDKInit();
+	}
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlayStateMachine: State machine not found! id=%d"), stateMachineId);
+		return;
+	}
+	//the state machine drives its animations, nothing else plays them or their devices
+	vector<AnimationBase*> animations = stateMachine->GetAnimations();
+	for (unsigned int i = 0; i < animations.size(); ++i)
+	{
+		AnimationBase* animation = animations[i];
+		StopAnimationType(animation->GetDeviceTypeId(), animation->GetDeviceId());
+		animation->Stop();
+	}
+	stateMachine->Play(state);
+}
+
+void FChromaSDKPluginModule::StopStateMachine(int stateMachineId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationStateMachine* stateMachine = GetStateMachine(stateMachineId);
+	if (nullptr == stateMachine)
+	{
+		return;
+	}
+	stateMachine->Stop();
+}
+
+void FChromaSDKPluginModule::PlayInstance(int instanceId, bool loop)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance)
+	{
+		return;
+	}
+	instance->Play(loop);
+}
+
+void FChromaSDKPluginModule::StopInstance(int instanceId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance)
+	{
+		return;
+	}
+	instance->Stop();
+}
+
+void FChromaSDKPluginModule::SetInstanceSpeed(int instanceId, float speed)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance)
+	{
+		return;
+	}
+	instance->SetSpeed(speed);
+}
+
+void FChromaSDKPluginModule::SetInstanceIntensity(int instanceId, float intensity)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance)
+	{
+		return;
+	}
+	instance->SetIntensity(intensity);
+}
+
+void FChromaSDKPluginModule::SetInstanceOffset(int instanceId, int rowOffset, int columnOffset)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance)
+	{
+		return;
+	}
+	instance->SetOffset(rowOffset, columnOffset);
+}
+
+void FChromaSDKPluginModule::SetInstanceDevice(int instanceId, int device)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	AnimationInstance* instance = GetInstance(instanceId);
+	if (nullptr == instance ||
+		device < 0 ||
+		device > (int)EChromaSDKDeviceEnum::DE_Mousepad)
+	{
+		return;
+	}
+	instance->SetDevice((EChromaSDKDeviceEnum)device);
+}
+
+void FChromaSDKPluginModule::CloseRetargets(int animationId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	vector<int> targetIds;
+	for (auto it = _mRetargets.begin(); it != _mRetargets.end();)
+	{
+		if (get<0>(it->first) == animationId)
+		{
+			targetIds.push_back(it->second.first);
+			it = _mRetargets.erase(it);
+		}
+		else if (it->second.first == animationId)
+		{
+			it = _mRetargets.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+	for (unsigned int i = 0; i < targetIds.size(); ++i)
+	{
+		CloseAnimation(targetIds[i]);
+	}
+}
+
+int FChromaSDKPluginModule::RetargetAnimation(int animationId, int device, int kernel)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	shared_ptr<AnimationBase> source = GetAnimationInstance(animationId);
+	if (nullptr == source ||
+		device < 0 ||
+		device > (int)EChromaSDKDeviceEnum::DE_Mousepad)
+	{
+		return -1;
+	}
+	const EChromaSDKDeviceEnum targetDevice = (EChromaSDKDeviceEnum)device;
+	if (Retarget::GetDevice(source.get()) == targetDevice)
+	{
+		return animationId;
+	}
+
+	//reuse the cached result, resample again only when the source was edited
+	const tuple<int, int, int> key = make_tuple(animationId, device, kernel);
+	shared_ptr<AnimationBase> target;
+	int targetId = -1;
+	auto it = _mRetargets.find(key);
+	if (it != _mRetargets.end())
+	{
+		targetId = it->second.first;
+		target = GetAnimationInstance(targetId);
+		if (target != nullptr &&
+			it->second.second == source->GetVersion())
+		{
+			return targetId;
+		}
+	}
+	if (target == nullptr)
+	{
+		AnimationBase* created = nullptr;
+		switch (targetDevice)
+		{
+		case EChromaSDKDeviceEnum::DE_ChromaLink:
+		case EChromaSDKDeviceEnum::DE_Headset:
+		case EChromaSDKDeviceEnum::DE_Mousepad:
+			{
+				Animation1D* target1D = new Animation1D();
+				target1D->SetDevice(targetDevice == EChromaSDKDeviceEnum::DE_ChromaLink ? EChromaSDKDevice1DEnum::DE_ChromaLink :
+					targetDevice == EChromaSDKDeviceEnum::DE_Headset ? EChromaSDKDevice1DEnum::DE_Headset :
+					EChromaSDKDevice1DEnum::DE_Mousepad);
+				created = target1D;
+			}
+			break;
+		default:
+			{
+				Animation2D* target2D = new Animation2D();
+				target2D->SetDevice(targetDevice == EChromaSDKDeviceEnum::DE_Keyboard ? EChromaSDKDevice2DEnum::DE_Keyboard :
+					targetDevice == EChromaSDKDeviceEnum::DE_Keypad ? EChromaSDKDevice2DEnum::DE_Keypad :
+					EChromaSDKDevice2DEnum::DE_Mouse);
+				created = target2D;
+			}
+			break;
+		}
+		targetId = _mAnimationId++;
+		//retargets are not in the name map, so the name only needs to be unique for display
+		created->SetName(source->GetName() + "#" + to_string(targetId));
+		RegisterAnimation(targetId, created, nullptr);
+		target = GetAnimationInstance(targetId);
+		if (target == nullptr)
+		{
+			return -1;
+		}
+	}
+
+	int sourceRows = 0;
+	int sourceColumns = 0;
+	int targetRows = 0;
+	int targetColumns = 0;
+	Retarget::GetGridSize(Retarget::GetDevice(source.get()), sourceRows, sourceColumns);
+	Retarget::GetGridSize(targetDevice, targetRows, targetColumns);
+	const EChromaSDKRetargetKernel kernelArg = (EChromaSDKRetargetKernel)kernel;
+
+	lock_guard<mutex> sourceGuard(source->GetFrameMutex());
+	const unsigned int version = source->GetVersion();
+	const int frameCount = source->GetFrameCount();
+	COLORREF scratch[MAX_COLORS_2D];
+	if (target->GetDeviceType() == EChromaSDKDeviceTypeEnum::DE_1D)
+	{
+		vector<FChromaFrame1D> frames(frameCount);
+		for (int index = 0; index < frameCount; ++index)
+		{
+			frames[index].Duration = source->GetDuration(index);
+			Retarget::Resample(source->GetFrameColors(index, scratch), sourceRows, sourceColumns,
+				frames[index].Colors, targetRows, targetColumns, kernelArg);
+		}
+		Animation1D* target1D = (Animation1D*)target.get();
+		lock_guard<mutex> targetGuard(target1D->GetFrameMutex());
+		target1D->GetFrames().swap(frames);
+		target1D->IndexFrames();
+		target1D->MarkFramesChanged(0, frameCount);
+	}
+	else
+	{
+		vector<FChromaFrame2D> frames(frameCount);
+		for (int index = 0; index < frameCount; ++index)
+		{
+			frames[index].Duration = source->GetDuration(index);
+			Retarget::Resample(source->GetFrameColors(index, scratch), sourceRows, sourceColumns,
+				frames[index].Colors, targetRows, targetColumns, kernelArg);
+		}
+		Animation2D* target2D = (Animation2D*)target.get();
+		lock_guard<mutex> targetGuard(target2D->GetFrameMutex());
+		target2D->GetFrames().swap(frames);
+		target2D->CompactFrames();
+		target2D->MarkFramesChanged(0, frameCount);
+	}
+	_mRetargets[key] = make_pair(targetId, version);
+	return targetId;
+}
+
+int FChromaSDKPluginModule::RetargetAnimationName(const char* path, int device, int kernel)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("RetargetAnimationName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return -1;
+	}
+	return RetargetAnimation(animationId, device, kernel);
+}
+
+void FChromaSDKPluginModule::PlayAnimationRetargeted(int animationId, bool loop)
+{
+	if (nullptr == GetAnimationInstance(animationId))
+	{
+		return;
+	}
+	for (int device = 0; device <= (int)EChromaSDKDeviceEnum::DE_Mousepad; ++device)
+	{
+		int targetId = RetargetAnimation(animationId, device, (int)EChromaSDKRetargetKernel::RK_AreaAverage);
+		if (targetId >= 0)
+		{
+			PlayAnimation(targetId, loop);
+		}
+	}
+}
+
+void FChromaSDKPluginModule::PlayAnimationRetargetedName(const char* path, bool loop)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlayAnimationRetargetedName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	PlayAnimationRetargeted(animationId, loop);
+}
+
+void FChromaSDKPluginModule::StopAnimationRetargeted(int animationId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	StopAnimation(animationId);
+	for (auto it = _mRetargets.begin(); it != _mRetargets.end(); ++it)
+	{
+		if (get<0>(it->first) == animationId)
+		{
+			StopAnimation(it->second.first);
+		}
+	}
+}
+
+void FChromaSDKPluginModule::StopAnimationRetargetedName(const char* path)
+{
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("StopAnimationRetargetedName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	StopAnimationRetargeted(animationId);
+}
+
+int FChromaSDKPluginModule::OpenComposite(const char* path)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	FILE* stream = nullptr;
+	if (0 != fopen_s(&stream, path, "rb") ||
+		stream == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("OpenComposite: Failed to open composite! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return -1;
+	}
 
-int FChromaSDKPluginModule::GetAnimation(const char* path)
-{
-	for (std::map<string, int>::iterator it = _mAnimationMapID.begin(); it != _mAnimationMapID.end(); ++it)
+	//buffer the whole file so every track is parsed from a single read
+	long size = _filelength(_fileno(stream));
+	if (size > 0)
 	{
-		const string& item = (*it).first;
-		if (item.compare(path) == 0) {
-			return (*it).second;
+		setvbuf(stream, nullptr, _IOFBF, size);
+	}
+
+	int version = 0;
+	if (fread(&version, sizeof(int), 1, stream) != 1 ||
+		version != ANIMATION_VERSION_COMPOSITE)
+	{
+		UE_LOG(LogTemp, Error, TEXT("OpenComposite: Unexpected Version! %s"), *FString(UTF8_TO_TCHAR(path)));
+		std::fclose(stream);
+		return -1;
+	}
+	int trackCount = 0;
+	if (fread(&trackCount, sizeof(int), 1, stream) != 1 ||
+		trackCount < 0 ||
+		trackCount > (int)EChromaSDKDeviceEnum::DE_Mousepad + 1)
+	{
+		UE_LOG(LogTemp, Error, TEXT("OpenComposite: Unexpected track count! %s"), *FString(UTF8_TO_TCHAR(path)));
+		std::fclose(stream);
+		return -1;
+	}
+
+	AnimationComposite* composite = new AnimationComposite();
+	composite->SetName(path);
+	for (int i = 0; i < trackCount; ++i)
+	{
+		AnimationBase* track = ReadAnimation(stream);
+		if (track == nullptr ||
+			!composite->AddTrack(track))
+		{
+			UE_LOG(LogTemp, Error, TEXT("OpenComposite: Failed to read track %d! %s"), i, *FString(UTF8_TO_TCHAR(path)));
+			delete track;
+			const vector<AnimationBase*>& tracks = composite->GetTracks();
+			for (unsigned int j = 0; j < tracks.size(); ++j)
+			{
+				delete tracks[j];
+			}
+			delete composite;
+			std::fclose(stream);
+			return -1;
 		}
 	}
-	return OpenAnimation(path);
+	std::fclose(stream);
+
+	//tracks are regular animations for editing by id, they are not in the name map
+	const vector<AnimationBase*>& tracks = composite->GetTracks();
+	for (unsigned int i = 0; i < tracks.size(); ++i)
+	{
+		int animationId = _mAnimationId++;
+		tracks[i]->SetName(string(path) + "#" + to_string(animationId));
+		RegisterAnimation(animationId, tracks[i], nullptr);
+	}
+	int id = _mCompositeId;
+	_mComposites[id] = composite;
+	++_mCompositeId;
+	_mCompositeMapID[path] = id;
+	return id;
 }
 
-const char* FChromaSDKPluginModule::GetAnimationName(int animationId)
+int FChromaSDKPluginModule::GetComposite(const char* path)
 {
-	if (animationId < 0)
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mCompositeMapID.find(path);
+	if (it != _mCompositeMapID.end())
 	{
-		return "";
+		return it->second;
 	}
-	AnimationBase* animation = GetAnimationInstance(animationId);
-	if (animation == nullptr)
+	return OpenComposite(path);
+}
+
+int FChromaSDKPluginModule::CloseComposite(int compositeId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mComposites.find(compositeId);
+	if (it == _mComposites.end())
 	{
-		return "";
+		return -1;
+	}
+	AnimationComposite* composite = it->second;
+	composite->Stop();
+	vector<AnimationBase*> tracks = composite->GetTracks();
+	_mComposites.erase(it);
+	_mCompositeMapID.erase(composite->GetName());
+	delete composite;
+	for (unsigned int i = 0; i < tracks.size(); ++i)
+	{
+		CloseAnimation(GetAnimationIdFromInstance(tracks[i]));
+	}
+	return compositeId;
+}
+
+int FChromaSDKPluginModule::CloseCompositeName(const char* path)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mCompositeMapID.find(path);
+	if (it == _mCompositeMapID.end())
+	{
+		return -1;
+	}
+	return CloseComposite(it->second);
+}
+
+void FChromaSDKPluginModule::PlayComposite(int compositeId, bool loop)
+{
+	if (!IsInitialized())
+	{
+		ChromaSDKInit();
+	}
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mComposites.find(compositeId);
+	if (it == _mComposites.end())
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlayComposite: Composite not found! id=%d"), compositeId);
+		return;
+	}
+	AnimationComposite* composite = it->second;
+	const vector<AnimationBase*>& tracks = composite->GetTracks();
+	for (unsigned int i = 0; i < tracks.size(); ++i)
+	{
+		ClaimDevice(GetAnimationIdFromInstance(tracks[i]), tracks[i]);
+	}
+	composite->Play(loop);
+}
+
+void FChromaSDKPluginModule::PlayCompositeName(const char* path, bool loop)
+{
+	int compositeId = GetComposite(path);
+	if (compositeId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlayCompositeName: Composite not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	PlayComposite(compositeId, loop);
+}
+
+void FChromaSDKPluginModule::StopComposite(int compositeId)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mComposites.find(compositeId);
+	if (it != _mComposites.end())
+	{
+		it->second->Stop();
+	}
+}
+
+void FChromaSDKPluginModule::StopCompositeName(const char* path)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mCompositeMapID.find(path);
+	if (it != _mCompositeMapID.end())
+	{
+		StopComposite(it->second);
+	}
+}
+
+int FChromaSDKPluginModule::GetCompositeTrack(int compositeId, int device)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mComposites.find(compositeId);
+	if (it == _mComposites.end() ||
+		device < 0 ||
+		device > (int)EChromaSDKDeviceEnum::DE_Mousepad)
+	{
+		return -1;
+	}
+	AnimationBase* track = it->second->GetTrack((EChromaSDKDeviceEnum)device);
+	if (track == nullptr)
+	{
+		return -1;
+	}
+	return GetAnimationIdFromInstance(track);
+}
+
+void FChromaSDKPluginModule::SetPlaybackTimeScale(float timeScale)
+{
+	ChromaThread::Instance()->SetTimeScale(timeScale);
+}
+
+void FChromaSDKPluginModule::SetPlaybackPaused(bool paused)
+{
+	ChromaThread::Instance()->SetPaused(paused);
+}
+
+void FChromaSDKPluginModule::SetAnimationTimeScale(int animationId, float timeScale)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation != nullptr)
+	{
+		animation->SetTimeScale(timeScale);
+	}
+}
+
+void FChromaSDKPluginModule::SetAnimationPaused(int animationId, bool paused)
+{
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation != nullptr)
+	{
+		animation->SetPaused(paused);
+	}
+}
+
+void FChromaSDKPluginModule::SetCompositeTimeScale(int compositeId, float timeScale)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mComposites.find(compositeId);
+	if (it != _mComposites.end())
+	{
+		it->second->SetTimeScale(timeScale);
+	}
+}
+
+void FChromaSDKPluginModule::SetCompositePaused(int compositeId, bool paused)
+{
+	lock_guard<recursive_mutex> objectGuard(_mObjectMutex);
+	auto it = _mComposites.find(compositeId);
+	if (it != _mComposites.end())
+	{
+		it->second->SetPaused(paused);
 	}
-	return animation->GetName().c_str();
+}
+
+int FChromaSDKPluginModule::SaveComposite(const char* path, const int* animationIds, int count)
+{
+	AnimationComposite composite;
+	for (int i = 0; i < count; ++i)
+	{
+		shared_ptr<AnimationBase> animation = GetAnimationInstance(animationIds[i]);
+		if (animation == nullptr ||
+			!composite.AddTrack(animation.get()))
+		{
+			UE_LOG(LogTemp, Error, TEXT("SaveComposite: Invalid animation or duplicate device! id=%d"), animationIds[i]);
+			return -1;
+		}
+	}
+	return composite.Save(path);
 }
 
 int FChromaSDKPluginModule::GetAnimationCount()
 {
-	return _mAnimationMapID.size();
+	return GetAnimationLookup()->Names.size();
 }
 
 int FChromaSDKPluginModule::GetAnimationId(int index)
 {
+	shared_ptr<const FAnimationRegistry::FSnapshot> lookup = GetAnimationLookup();
 	int i = 0;
-	for (std::map<string, int>::iterator it = _mAnimationMapID.begin(); it != _mAnimationMapID.end(); ++it)
+	for (auto it = lookup->Names.begin(); it != lookup->Names.end(); ++it)
 	{
 		if (index == i)
 		{
@@ -1070,27 +2850,93 @@ void FChromaSDKPluginModule::PlayAnimation(int animationId, bool loop)
 	{
 		ChromaSDKInit();
 	}
-	if (_mAnimations.find(animationId) != _mAnimations.end())
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation == nullptr)
+	{
+		return;
+	}
+	ClaimDevice(animationId, animation.get());
+	//UE_LOG(LogTemp, Log, TEXT("PlayAnimation: %s"), *FString(UTF8_TO_TCHAR(animation->GetName().c_str())));
+	animation->Play(loop);
+}
+
+void FChromaSDKPluginModule::PlayAnimations(const int* animationIds, int count, bool loop)
+{
+	if (!IsInitialized())
+	{
+		ChromaSDKInit();
+	}
+	//the references keep every animation alive until ChromaThread has them or refused them as closed
+	vector<shared_ptr<AnimationBase>> references;
+	vector<AnimationBase*> group;
+	for (int i = 0; i < count; ++i)
 	{
-		AnimationBase* animation = _mAnimations[animationId];
+		shared_ptr<AnimationBase> animation = GetAnimationInstance(animationIds[i]);
 		if (animation == nullptr)
 		{
-			UE_LOG(LogTemp, Error, TEXT("PlayAnimation: Animation is null! id=%d"), animationId);
-			return;
+			UE_LOG(LogTemp, Error, TEXT("PlayAnimations: Animation not found! id=%d"), animationIds[i]);
+			continue;
 		}
-		StopAnimationType(animation->GetDeviceTypeId(), animation->GetDeviceId());
-		switch (animation->GetDeviceType())
+		ClaimDevice(animationIds[i], animation.get());
+		animation->Start(loop);
+		references.push_back(animation);
+		group.push_back(animation.get());
+	}
+	ChromaThread::Instance()->AddAnimations(group);
+}
+
+void FChromaSDKPluginModule::ClaimDevice(int animationId, AnimationBase* animation)
+{
+	StopAnimationType(animation->GetDeviceTypeId(), animation->GetDeviceId());
+	atomic<int>* slot = GetPlayMapSlot(animation->GetDeviceTypeId(), animation->GetDeviceId());
+	if (slot != nullptr)
+	{
+		slot->store(animationId);
+	}
+}
+
+atomic<int>* FChromaSDKPluginModule::GetPlayMapSlot(int deviceType, int device)
+{
+	switch ((EChromaSDKDeviceTypeEnum)deviceType)
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		if (device >= 0 &&
+			device < PLAY_MAP_1D_SIZE)
 		{
-		case EChromaSDKDeviceTypeEnum::DE_1D:
-			_mPlayMap1D[(EChromaSDKDevice1DEnum)animation->GetDeviceId()] = animationId;
-			break;
-		case EChromaSDKDeviceTypeEnum::DE_2D:
-			_mPlayMap2D[(EChromaSDKDevice2DEnum)animation->GetDeviceId()] = animationId;
-			break;
+			return &_mPlayMap1D[device];
+		}
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		if (device >= 0 &&
+			device < PLAY_MAP_2D_SIZE)
+		{
+			return &_mPlayMap2D[device];
+		}
+		break;
+	}
+	return nullptr;
+}
+
+atomic<unsigned int>* FChromaSDKPluginModule::GetShowCountSlot(int deviceType, int device)
+{
+	switch ((EChromaSDKDeviceTypeEnum)deviceType)
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		if (device >= 0 &&
+			device < PLAY_MAP_1D_SIZE)
+		{
+			return &_mShowCount1D[device];
+		}
+		break;
+	case EChromaSDKDeviceTypeEnum::DE_2D:
+		if (device >= 0 &&
+			device < PLAY_MAP_2D_SIZE)
+		{
+			return &_mShowCount2D[device];
 		}
-		//UE_LOG(LogTemp, Log, TEXT("PlayAnimation: %s"), *FString(UTF8_TO_TCHAR(animation->GetName().c_str())));
-		animation->Play(loop);
+		break;
 	}
+	return nullptr;
 }
 
 void FChromaSDKPluginModule::PlayAnimationName(const char* path, bool loop)
@@ -1108,23 +2954,78 @@ void FChromaSDKPluginModule::PlayAnimationName(const char* path, bool loop)
 	PlayAnimation(animationId, loop);
 }
 
+void FChromaSDKPluginModule::PlayAnimationTransition(int animationId, bool loop, int transition, float duration)
+{
+	if (!IsInitialized())
+	{
+		ChromaSDKInit();
+	}
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlayAnimationTransition: Animation not found! id=%d"), animationId);
+		return;
+	}
+	atomic<int>* slot = GetPlayMapSlot(animation->GetDeviceTypeId(), animation->GetDeviceId());
+	int previousId = slot != nullptr ? slot->load() : -1;
+	EChromaSDKDeviceEnum device;
+	switch (animation->GetDeviceType())
+	{
+	case EChromaSDKDeviceTypeEnum::DE_1D:
+		device = ChromaCanvas::ToDevice((EChromaSDKDevice1DEnum)animation->GetDeviceId());
+		break;
+	default:
+		device = ChromaCanvas::ToDevice((EChromaSDKDevice2DEnum)animation->GetDeviceId());
+		break;
+	}
+	shared_ptr<AnimationBase> previous = GetAnimationInstance(previousId);
+	if (duration <= 0.0f ||
+		previous == nullptr ||
+		previous == animation ||
+		!previous->IsPlaying())
+	{
+		//nothing to blend from, a hard cut
+		PlayAnimation(animationId, loop);
+		return;
+	}
+
+	//the outgoing animation keeps playing until the transition finishes it
+	if (slot != nullptr)
+	{
+		slot->store(animationId);
+	}
+	animation->Start(loop);
+	ChromaThread::Instance()->AddTransition(previous.get(), animation.get(), device, (EChromaSDKTransitionEnum)transition, duration);
+}
+
+void FChromaSDKPluginModule::PlayAnimationTransitionName(const char* path, bool loop, int transition, float duration)
+{
+	if (!IsInitialized())
+	{
+		ChromaSDKInit();
+	}
+	int animationId = GetAnimation(path);
+	if (animationId < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PlayAnimationTransitionName: Animation not found! %s"), *FString(UTF8_TO_TCHAR(path)));
+		return;
+	}
+	PlayAnimationTransition(animationId, loop, transition, duration);
+}
+
 void FChromaSDKPluginModule::StopAnimation(int animationId)
 {
 	if (!IsInitialized())
 	{
 		ChromaSDKInit();
 	}
-	if (_mAnimations.find(animationId) != _mAnimations.end())
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation == nullptr)
 	{
-		AnimationBase* animation = _mAnimations[animationId];
-		if (animation == nullptr)
-		{
-			UE_LOG(LogTemp, Error, TEXT("StopAnimation: Animation is null! id=%d"), animationId);
-			return;
-		}
-		//UE_LOG(LogTemp, Log, TEXT("StopAnimation: %s"), *FString(UTF8_TO_TCHAR(animation->GetName().c_str())));
-		animation->Stop();
+		return;
 	}
+	//UE_LOG(LogTemp, Log, TEXT("StopAnimation: %s"), *FString(UTF8_TO_TCHAR(animation->GetName().c_str())));
+	animation->Stop();
 }
 
 void FChromaSDKPluginModule::StopAnimationName(const char* path)
@@ -1144,34 +3045,16 @@ void FChromaSDKPluginModule::StopAnimationName(const char* path)
 
 void FChromaSDKPluginModule::StopAnimationType(int deviceType, int device)
 {
-	switch ((EChromaSDKDeviceTypeEnum)deviceType)
+	atomic<int>* slot = GetPlayMapSlot(deviceType, device);
+	if (slot == nullptr)
 	{
-	case EChromaSDKDeviceTypeEnum::DE_1D:
-		{
-			if (_mPlayMap1D.find((EChromaSDKDevice1DEnum)device) != _mPlayMap1D.end())
-			{
-				int prevAnimation = _mPlayMap1D[(EChromaSDKDevice1DEnum)device];
-				if (prevAnimation != -1)
-				{
-					StopAnimation(prevAnimation);
-					_mPlayMap1D[(EChromaSDKDevice1DEnum)device] = -1;
-				}
-			}
-		}
-		break;
-	case EChromaSDKDeviceTypeEnum::DE_2D:
-		{
-			if (_mPlayMap2D.find((EChromaSDKDevice2DEnum)device) != _mPlayMap2D.end())
-			{
-				int prevAnimation = _mPlayMap2D[(EChromaSDKDevice2DEnum)device];
-				if (prevAnimation != -1)
-				{
-					StopAnimation(prevAnimation);
-					_mPlayMap2D[(EChromaSDKDevice2DEnum)device] = -1;
-				}
-			}
-		}
-		break;
+		return;
+	}
+	//take the id so concurrent callers stop it only once
+	int prevAnimation = slot->exchange(-1);
+	if (prevAnimation != -1)
+	{
+		StopAnimation(prevAnimation);
 	}
 }
 
@@ -1181,17 +3064,12 @@ bool FChromaSDKPluginModule::IsAnimationPlaying(int animationId)
 	{
 		ChromaSDKInit();
 	}
-	if (_mAnimations.find(animationId) != _mAnimations.end())
+	shared_ptr<AnimationBase> animation = GetAnimationInstance(animationId);
+	if (animation == nullptr)
 	{
-		AnimationBase* animation = _mAnimations[animationId];
-		if (animation == nullptr)
-		{
-			UE_LOG(LogTemp, Error, TEXT("IsAnimationPlaying: Animation is null! id=%d"), animationId);
-			return false;
-		}
-		return animation->IsPlaying();
+		return false;
 	}
-	return false;
+	return animation->IsPlaying();
 }
 
 bool FChromaSDKPluginModule::IsAnimationPlayingName(const char* path)
@@ -1211,32 +3089,15 @@ bool FChromaSDKPluginModule::IsAnimationPlayingName(const char* path)
 
 bool FChromaSDKPluginModule::IsAnimationPlayingType(int deviceType, int device)
 {
-	switch ((EChromaSDKDeviceTypeEnum)deviceType)
+	atomic<int>* slot = GetPlayMapSlot(deviceType, device);
+	if (slot == nullptr)
 	{
-	case EChromaSDKDeviceTypeEnum::DE_1D:
-		{
-			if (_mPlayMap1D.find((EChromaSDKDevice1DEnum)device) != _mPlayMap1D.end())
-			{
-				int prevAnimation = _mPlayMap1D[(EChromaSDKDevice1DEnum)device];
-				if (prevAnimation != -1)
-				{
-					return IsAnimationPlaying(prevAnimation);
-				}
-			}
-		}
-		break;
-	case EChromaSDKDeviceTypeEnum::DE_2D:
-		{
-			if (_mPlayMap2D.find((EChromaSDKDevice2DEnum)device) != _mPlayMap2D.end())
-			{
-				int prevAnimation = _mPlayMap2D[(EChromaSDKDevice2DEnum)device];
-				if (prevAnimation != -1)
-				{
-					return IsAnimationPlaying(prevAnimation);
-				}
-			}
-		}
-		break;
+		return false;
+	}
+	int prevAnimation = slot->load();
+	if (prevAnimation != -1)
+	{
+		return IsAnimationPlaying(prevAnimation);
 	}
 	return false;
 }
@@ -5,6 +5,9 @@
 #include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
 
 #include "ChromaSDKPluginBPLibrary.h"
+#include "ChromaEffectPlayer.h"
+#include "ChromaThread.h"
+#include <vector>
 
 UChromaSDKPluginAnimation2DObject::UChromaSDKPluginAnimation2DObject(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -19,39 +22,44 @@ UChromaSDKPluginAnimation2DObject::UChromaSDKPluginAnimation2DObject(const FObje
 	OverrideFrameTime = 0.1f;
 
 	_mIsPlaying = false;
-	_mTime = 0.0f;
-	_mCurrentFrame = 0;
+	_mPlayer = new ChromaSDK::ChromaEffectPlayer();
 #endif
 }
 
+void UChromaSDKPluginAnimation2DObject::BeginDestroy()
+{
+#if PLATFORM_WINDOWS
+	//the object stops ticking before the player goes away
+	_mIsPlaying = false;
+	if (_mPlayer != nullptr)
+	{
+		_mPlayer->Stop();
+		delete _mPlayer;
+		_mPlayer = nullptr;
+	}
+#endif
+	Super::BeginDestroy();
+}
+
 void UChromaSDKPluginAnimation2DObject::Tick(float deltaTime)
 {
 #if PLATFORM_WINDOWS
-	_mTime += deltaTime;
-	float nextTime = GetTime(_mCurrentFrame);
-	if (nextTime < _mTime)
+	if (_mPlayer == nullptr)
 	{
-		++_mCurrentFrame;
-		if (_mCurrentFrame < _mEffects.Num())
-		{
-			//UE_LOG(LogTemp, Log, TEXT("UChromaSDKPluginAnimation2DObject::Tick SetEffect."));
-			FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-			int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-			if (result != 0)
-			{
-				UE_LOG(LogTemp, Error, TEXT("UChromaSDKPluginAnimation2DObject::Tick Failed to set effect!"));
-			}
-		}
-		else
-		{
-			//UE_LOG(LogTemp, Log, TEXT("UChromaSDKPluginAnimation2DObject::Tick Animation Complete."));
-			_mIsPlaying = false;
-			_mTime = 0.0f;
-			_mCurrentFrame = 0;
+		return;
+	}
 
-			// execute the complete event if set
-			_mOnComplete.ExecuteIfBound(this);
-		}
+	//playback runs on ChromaThread on the game clock, the tick feeds it scaled game time
+	_mPlayer->AdvanceTime(deltaTime);
+
+	//only the completion is delivered here
+	if (_mPlayer->TakeCompleted())
+	{
+		//UE_LOG(LogTemp, Log, TEXT("UChromaSDKPluginAnimation2DObject::Tick Animation Complete."));
+		_mIsPlaying = false;
+
+		// execute the complete event if set
+		_mOnComplete.ExecuteIfBound(this);
 	}
 #endif
 }
@@ -59,6 +67,7 @@ void UChromaSDKPluginAnimation2DObject::Tick(float deltaTime)
 bool UChromaSDKPluginAnimation2DObject::IsTickable() const
 {
 #if PLATFORM_WINDOWS
+	//the game pause holds playback and the completion event through IsTickableWhenPaused
 	return _mIsPlaying;
 #else
 	return false;
@@ -94,6 +103,19 @@ float UChromaSDKPluginAnimation2DObject::GetTime(int index)
 	}
 	return 0.033f;
 }
+
+void UChromaSDKPluginAnimation2DObject::PlayEffects()
+{
+	std::vector<RZEFFECTID> effects;
+	std::vector<float> times;
+	for (int i = 0; i < _mEffects.Num(); ++i)
+	{
+		effects.push_back(_mEffects[i].EffectId.Data);
+		times.push_back(GetTime(i));
+	}
+	_mIsPlaying = true;
+	_mPlayer->Play(effects, times);
+}
 #endif
 
 void UChromaSDKPluginAnimation2DObject::Load()
@@ -138,6 +160,10 @@ void UChromaSDKPluginAnimation2DObject::Unload()
 		return;
 	}
 
+	//the player may be showing one of the effects
+	_mPlayer->Stop();
+	_mIsPlaying = false;
+
 	for (int i = 0; i < _mEffects.Num(); ++i)
 	{
 		FChromaSDKEffectResult& effect = _mEffects[i];
@@ -168,20 +194,7 @@ void UChromaSDKPluginAnimation2DObject::Play()
 		_mOnComplete.Clear();
 	}
 
-	_mTime = 0.0f;
-	_mIsPlaying = true;
-	_mCurrentFrame = 0;
-
-	if (_mCurrentFrame < _mEffects.Num())
-	{
-		//UE_LOG(LogTemp, Log, TEXT("UChromaSDKPluginAnimation2DObject::Play SetEffect."));
-		FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-		int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-		if (result != 0)
-		{
-			UE_LOG(LogTemp, Error, TEXT("UChromaSDKPluginAnimation2DObject::Tick Failed to set effect!"));
-		}
-	}
+	PlayEffects();
 #endif
 }
 
@@ -197,20 +210,7 @@ void UChromaSDKPluginAnimation2DObject::PlayWithOnComplete(FDelegateChomaSDKOnCo
 
 	_mOnComplete = onComplete;
 	
-	_mTime = 0.0f;
-	_mIsPlaying = true;
-	_mCurrentFrame = 0;
-
-	if (_mCurrentFrame < _mEffects.Num())
-	{
-		//UE_LOG(LogTemp, Log, TEXT("UChromaSDKPluginAnimation2DObject::Play SetEffect."));
-		FChromaSDKEffectResult& effect = _mEffects[_mCurrentFrame];
-		int result = UChromaSDKPluginBPLibrary::ChromaSDKSetEffect(effect.EffectId);
-		if (result != 0)
-		{
-			UE_LOG(LogTemp, Error, TEXT("UChromaSDKPluginAnimation2DObject::Tick Failed to set effect!"));
-		}
-	}
+	PlayEffects();
 #endif
 }
 
@@ -218,16 +218,16 @@ void UChromaSDKPluginAnimation2DObject::Stop()
 {
 #if PLATFORM_WINDOWS
 	//UE_LOG(LogTemp, Log, TEXT("UChromaSDKPluginAnimation2DObject::Stop"));
+	_mPlayer->Stop();
 	_mIsPlaying = false;
-	_mTime = 0.0f;
-	_mCurrentFrame = 0;
 #endif
 }
 
 bool UChromaSDKPluginAnimation2DObject::IsPlaying()
 {
 #if PLATFORM_WINDOWS
-	return _mIsPlaying;
+	return _mPlayer != nullptr &&
+		_mPlayer->IsPlaying();
 #else
 	return false;
 #endif
@@ -6,6 +6,11 @@
 
 #include "ChromaSDKPluginAnimation1DObject.h"
 #include "ChromaSDKPluginAnimation2DObject.h"
+#include "ChromaColor.h"
+#include "ChromaDraw.h"
+#include "ChromaEventDispatcher.h"
+#include "ChromaSDKKeyMap.h"
+#include "ChromaThread.h"
 #include <string>
 
 #if PLATFORM_WINDOWS
@@ -15,14 +20,6 @@
 using namespace ChromaSDK;
 using namespace std;
 
-// keyboard map
-std::map<EChromaSDKKeyboardKey, int> UChromaSDKPluginBPLibrary::_sKeyboardEnumMap =
-	std::map<EChromaSDKKeyboardKey, int>();
-
-// mouse map
-std::map<EChromaSDKMouseLed, ChromaSDK::Mouse::RZLED2> UChromaSDKPluginBPLibrary::_sMouseEnumMap =
-	std::map<EChromaSDKMouseLed, ChromaSDK::Mouse::RZLED2>();
-
 // initialized
 bool UChromaSDKPluginBPLibrary::_sInitialized = false;
 
@@ -32,157 +29,6 @@ UChromaSDKPluginBPLibrary::UChromaSDKPluginBPLibrary(const FObjectInitializer& O
 : Super(ObjectInitializer)
 {
 #if PLATFORM_WINDOWS
-	// keyboard mapping
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_ESC] = Keyboard::RZKEY::RZKEY_ESC;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F1] = Keyboard::RZKEY::RZKEY_F1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F2] = Keyboard::RZKEY::RZKEY_F2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F3] = Keyboard::RZKEY::RZKEY_F3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F4] = Keyboard::RZKEY::RZKEY_F4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F5] = Keyboard::RZKEY::RZKEY_F5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F6] = Keyboard::RZKEY::RZKEY_F6;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F7] = Keyboard::RZKEY::RZKEY_F7;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F8] = Keyboard::RZKEY::RZKEY_F8;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F9] = Keyboard::RZKEY::RZKEY_F9;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F10] = Keyboard::RZKEY::RZKEY_F10;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F11] = Keyboard::RZKEY::RZKEY_F11;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F12] = Keyboard::RZKEY::RZKEY_F12;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_1] = Keyboard::RZKEY::RZKEY_1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_2] = Keyboard::RZKEY::RZKEY_2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_3] = Keyboard::RZKEY::RZKEY_3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_4] = Keyboard::RZKEY::RZKEY_4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_5] = Keyboard::RZKEY::RZKEY_5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_6] = Keyboard::RZKEY::RZKEY_6;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_7] = Keyboard::RZKEY::RZKEY_7;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_8] = Keyboard::RZKEY::RZKEY_8;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_9] = Keyboard::RZKEY::RZKEY_9;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_0] = Keyboard::RZKEY::RZKEY_0;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_A] = Keyboard::RZKEY::RZKEY_A;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_B] = Keyboard::RZKEY::RZKEY_B;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_C] = Keyboard::RZKEY::RZKEY_C;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_D] = Keyboard::RZKEY::RZKEY_D;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_E] = Keyboard::RZKEY::RZKEY_E;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_F] = Keyboard::RZKEY::RZKEY_F;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_G] = Keyboard::RZKEY::RZKEY_G;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_H] = Keyboard::RZKEY::RZKEY_H;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_I] = Keyboard::RZKEY::RZKEY_I;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_J] = Keyboard::RZKEY::RZKEY_J;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_K] = Keyboard::RZKEY::RZKEY_K;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_L] = Keyboard::RZKEY::RZKEY_L;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_M] = Keyboard::RZKEY::RZKEY_M;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_N] = Keyboard::RZKEY::RZKEY_N;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_O] = Keyboard::RZKEY::RZKEY_O;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_P] = Keyboard::RZKEY::RZKEY_P;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_Q] = Keyboard::RZKEY::RZKEY_Q;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_R] = Keyboard::RZKEY::RZKEY_R;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_S] = Keyboard::RZKEY::RZKEY_S;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_T] = Keyboard::RZKEY::RZKEY_T;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_U] = Keyboard::RZKEY::RZKEY_U;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_V] = Keyboard::RZKEY::RZKEY_V;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_W] = Keyboard::RZKEY::RZKEY_W;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_X] = Keyboard::RZKEY::RZKEY_X;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_Y] = Keyboard::RZKEY::RZKEY_Y;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_Z] = Keyboard::RZKEY::RZKEY_Z;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMLOCK] = Keyboard::RZKEY::RZKEY_NUMLOCK;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD0] = Keyboard::RZKEY::RZKEY_NUMPAD0;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD1] = Keyboard::RZKEY::RZKEY_NUMPAD1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD2] = Keyboard::RZKEY::RZKEY_NUMPAD2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD3] = Keyboard::RZKEY::RZKEY_NUMPAD3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD4] = Keyboard::RZKEY::RZKEY_NUMPAD4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD5] = Keyboard::RZKEY::RZKEY_NUMPAD5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD6] = Keyboard::RZKEY::RZKEY_NUMPAD6;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD7] = Keyboard::RZKEY::RZKEY_NUMPAD7;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD8] = Keyboard::RZKEY::RZKEY_NUMPAD8;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD9] = Keyboard::RZKEY::RZKEY_NUMPAD9;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD_DIVIDE] = Keyboard::RZKEY::RZKEY_NUMPAD_DIVIDE;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD_MULTIPLY] = Keyboard::RZKEY::RZKEY_NUMPAD_MULTIPLY;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD_SUBTRACT] = Keyboard::RZKEY::RZKEY_NUMPAD_SUBTRACT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD_ADD] = Keyboard::RZKEY::RZKEY_NUMPAD_ADD;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD_ENTER] = Keyboard::RZKEY::RZKEY_NUMPAD_ENTER;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_NUMPAD_DECIMAL] = Keyboard::RZKEY::RZKEY_NUMPAD_DECIMAL;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_PRINTSCREEN] = Keyboard::RZKEY::RZKEY_PRINTSCREEN;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_SCROLL] = Keyboard::RZKEY::RZKEY_SCROLL;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_PAUSE] = Keyboard::RZKEY::RZKEY_PAUSE;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_INSERT] = Keyboard::RZKEY::RZKEY_INSERT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_HOME] = Keyboard::RZKEY::RZKEY_HOME;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_PAGEUP] = Keyboard::RZKEY::RZKEY_PAGEUP;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_DELETE] = Keyboard::RZKEY::RZKEY_DELETE;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_END] = Keyboard::RZKEY::RZKEY_END;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_PAGEDOWN] = Keyboard::RZKEY::RZKEY_PAGEDOWN;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_UP] = Keyboard::RZKEY::RZKEY_UP;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_LEFT] = Keyboard::RZKEY::RZKEY_LEFT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_DOWN] = Keyboard::RZKEY::RZKEY_DOWN;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_RIGHT] = Keyboard::RZKEY::RZKEY_RIGHT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_TAB] = Keyboard::RZKEY::RZKEY_TAB;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_CAPSLOCK] = Keyboard::RZKEY::RZKEY_CAPSLOCK;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_BACKSPACE] = Keyboard::RZKEY::RZKEY_BACKSPACE;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_ENTER] = Keyboard::RZKEY::RZKEY_ENTER;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_LCTRL] = Keyboard::RZKEY::RZKEY_LCTRL;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_LWIN] = Keyboard::RZKEY::RZKEY_LWIN;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_LALT] = Keyboard::RZKEY::RZKEY_LALT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_SPACE] = Keyboard::RZKEY::RZKEY_SPACE;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_RALT] = Keyboard::RZKEY::RZKEY_RALT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_FN] = Keyboard::RZKEY::RZKEY_FN;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_RMENU] = Keyboard::RZKEY::RZKEY_RMENU;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_RCTRL] = Keyboard::RZKEY::RZKEY_RCTRL;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_LSHIFT] = Keyboard::RZKEY::RZKEY_LSHIFT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_RSHIFT] = Keyboard::RZKEY::RZKEY_RSHIFT;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_MACRO1] = Keyboard::RZKEY::RZKEY_MACRO1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_MACRO2] = Keyboard::RZKEY::RZKEY_MACRO2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_MACRO3] = Keyboard::RZKEY::RZKEY_MACRO3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_MACRO4] = Keyboard::RZKEY::RZKEY_MACRO4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_MACRO5] = Keyboard::RZKEY::RZKEY_MACRO5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_1] = Keyboard::RZKEY::RZKEY_OEM_1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_2] = Keyboard::RZKEY::RZKEY_OEM_2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_3] = Keyboard::RZKEY::RZKEY_OEM_3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_4] = Keyboard::RZKEY::RZKEY_OEM_4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_5] = Keyboard::RZKEY::RZKEY_OEM_5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_6] = Keyboard::RZKEY::RZKEY_OEM_6;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_7] = Keyboard::RZKEY::RZKEY_OEM_7;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_8] = Keyboard::RZKEY::RZKEY_OEM_8;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_9] = Keyboard::RZKEY::RZKEY_OEM_9;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_10] = Keyboard::RZKEY::RZKEY_OEM_10;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_OEM_11] = Keyboard::RZKEY::RZKEY_OEM_11;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_EUR_1] = Keyboard::RZKEY::RZKEY_EUR_1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_EUR_2] = Keyboard::RZKEY::RZKEY_EUR_2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_JPN_1] = Keyboard::RZKEY::RZKEY_JPN_1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_JPN_2] = Keyboard::RZKEY::RZKEY_JPN_2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_JPN_3] = Keyboard::RZKEY::RZKEY_JPN_3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_JPN_4] = Keyboard::RZKEY::RZKEY_JPN_4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_JPN_5] = Keyboard::RZKEY::RZKEY_JPN_5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_1] = Keyboard::RZKEY::RZKEY_KOR_1;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_2] = Keyboard::RZKEY::RZKEY_KOR_2;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_3] = Keyboard::RZKEY::RZKEY_KOR_3;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_4] = Keyboard::RZKEY::RZKEY_KOR_4;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_5] = Keyboard::RZKEY::RZKEY_KOR_5;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_6] = Keyboard::RZKEY::RZKEY_KOR_6;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_KOR_7] = Keyboard::RZKEY::RZKEY_KOR_7;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_LOGO] = Keyboard::RZLED::RZLED_LOGO;
-	_sKeyboardEnumMap[EChromaSDKKeyboardKey::KK_INVALID] = Keyboard::RZKEY::RZKEY_INVALID;
-
-	// mouse mapping
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_SCROLLWHEEL] = Mouse::RZLED2::RZLED2_SCROLLWHEEL;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LOGO] = Mouse::RZLED2::RZLED2_LOGO;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_BACKLIGHT] = Mouse::RZLED2::RZLED2_BACKLIGHT;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE1] = Mouse::RZLED2::RZLED2_LEFT_SIDE1;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE2] = Mouse::RZLED2::RZLED2_LEFT_SIDE2;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE3] = Mouse::RZLED2::RZLED2_LEFT_SIDE3;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE4] = Mouse::RZLED2::RZLED2_LEFT_SIDE4;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE5] = Mouse::RZLED2::RZLED2_LEFT_SIDE5;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE6] = Mouse::RZLED2::RZLED2_LEFT_SIDE6;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_LEFT_SIDE7] = Mouse::RZLED2::RZLED2_LEFT_SIDE7;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_BOTTOM1] = Mouse::RZLED2::RZLED2_BOTTOM1;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_BOTTOM2] = Mouse::RZLED2::RZLED2_BOTTOM2;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_BOTTOM3] = Mouse::RZLED2::RZLED2_BOTTOM3;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_BOTTOM4] = Mouse::RZLED2::RZLED2_BOTTOM4;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_BOTTOM5] = Mouse::RZLED2::RZLED2_BOTTOM5;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE1] = Mouse::RZLED2::RZLED2_RIGHT_SIDE1;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE2] = Mouse::RZLED2::RZLED2_RIGHT_SIDE2;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE3] = Mouse::RZLED2::RZLED2_RIGHT_SIDE3;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE4] = Mouse::RZLED2::RZLED2_RIGHT_SIDE4;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE5] = Mouse::RZLED2::RZLED2_RIGHT_SIDE5;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE6] = Mouse::RZLED2::RZLED2_RIGHT_SIDE6;
-	_sMouseEnumMap[EChromaSDKMouseLed::ML_RIGHT_SIDE7] = Mouse::RZLED2::RZLED2_RIGHT_SIDE7;
-
 	FModuleManager::LoadModuleChecked<FChromaSDKPluginModule>("ChromaSDKPlugin");
 	ChromaSDKInit();
 #endif
@@ -339,10 +185,10 @@ const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::SetKeyboardKeyColor(c
 		return colors;
 	}
 
-	int rzkey = _sKeyboardEnumMap[key];
-	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
+	const KeyMap::FKeyLocation& location = KeyMap::GetKeyboardLocation(key);
+	if (location.RzKey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
-		colors[HIBYTE(rzkey)].Colors[LOBYTE(rzkey)] = color;
+		colors[location.Row].Colors[location.Column] = color;
 	}
 #endif
 	return colors;
@@ -365,8 +211,11 @@ const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::SetMouseLedColor(cons
 		return colors;
 	}
 
-	ChromaSDK::Mouse::RZLED2 rzled = _sMouseEnumMap[led];
-	colors[HIBYTE(rzled)].Colors[LOBYTE(rzled)] = color;
+	if (KeyMap::IsValidMouseLed(led))
+	{
+		const KeyMap::FKeyLocation& location = KeyMap::GetMouseLocation(led);
+		colors[location.Row].Colors[location.Column] = color;
+	}
 #endif
 	return colors;
 }
@@ -488,9 +337,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectStatic(co
 #if PLATFORM_WINDOWS
 
 	//UE_LOG(LogTemp, Log, TEXT("ChromaSDKPlugin:: Color R=%f G=%f B=%f"), color.R, color.G, color.B);	
-	int red = color.R * 255;
-	int green = color.G * 255;
-	int blue = color.B * 255;
+	COLORREF bgrColor = Color::ToBGR(color);
 	
 	int result = 0;
 	RZEFFECTID effectId = RZEFFECTID();
@@ -499,35 +346,35 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectStatic(co
 	case EChromaSDKDeviceEnum::DE_ChromaLink:
 		{
 			ChromaSDK::ChromaLink::STATIC_EFFECT_TYPE pParam = {};
-			pParam.Color = RGB(red, green, blue);
+			pParam.Color = bgrColor;
 			result = FChromaSDKPluginModule::Get().ChromaSDKCreateChromaLinkEffect(ChromaSDK::ChromaLink::CHROMA_STATIC, &pParam, &effectId);
 		}
 		break;
 	case EChromaSDKDeviceEnum::DE_Headset:
 		{
 			ChromaSDK::Headset::STATIC_EFFECT_TYPE pParam = {};
-			pParam.Color = RGB(red, green, blue);
+			pParam.Color = bgrColor;
 			result = FChromaSDKPluginModule::Get().ChromaSDKCreateHeadsetEffect(ChromaSDK::Headset::CHROMA_STATIC, &pParam, &effectId);
 		}
 		break;
 	case EChromaSDKDeviceEnum::DE_Keyboard:
 		{
 			ChromaSDK::Keyboard::STATIC_EFFECT_TYPE pParam = {};
-			pParam.Color = RGB(red, green, blue);
+			pParam.Color = bgrColor;
 			result = FChromaSDKPluginModule::Get().ChromaSDKCreateKeyboardEffect(ChromaSDK::Keyboard::CHROMA_STATIC, &pParam, &effectId);
 		}
 		break;
 	case EChromaSDKDeviceEnum::DE_Keypad:
 		{
 			ChromaSDK::Keypad::STATIC_EFFECT_TYPE pParam = {};
-			pParam.Color = RGB(red, green, blue);
+			pParam.Color = bgrColor;
 			result = FChromaSDKPluginModule::Get().ChromaSDKCreateKeypadEffect(ChromaSDK::Keypad::CHROMA_STATIC, &pParam, &effectId);
 		}
 		break;
 	case EChromaSDKDeviceEnum::DE_Mouse:
 		{
 			ChromaSDK::Mouse::STATIC_EFFECT_TYPE pParam = {};
-			pParam.Color = RGB(red, green, blue);
+			pParam.Color = bgrColor;
 			pParam.LEDId = ChromaSDK::Mouse::RZLED_ALL;
 			result = FChromaSDKPluginModule::Get().ChromaSDKCreateMouseEffect(ChromaSDK::Mouse::CHROMA_STATIC, &pParam, &effectId);
 		}
@@ -535,7 +382,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectStatic(co
 	case EChromaSDKDeviceEnum::DE_Mousepad:
 		{
 			ChromaSDK::Mousepad::STATIC_EFFECT_TYPE pParam = {};
-			pParam.Color = RGB(red, green, blue);
+			pParam.Color = bgrColor;
 			result = FChromaSDKPluginModule::Get().ChromaSDKCreateMousepadEffect(ChromaSDK::Mousepad::CHROMA_STATIC, &pParam, &effectId);
 		}
 		break;
@@ -573,14 +420,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom1D(
 			break;
 		}
 		ChromaSDK::ChromaLink::CUSTOM_EFFECT_TYPE pParam = {};
-		for (int i = 0; i < maxLeds; i++)
-		{
-			const FLinearColor& color = colors[i];
-			int red = color.R * 255;
-			int green = color.G * 255;
-			int blue = color.B * 255;
-			pParam.Color[i] = RGB(red, green, blue);
-		}
+		Color::ToBGR(colors.GetData(), pParam.Color, maxLeds);
 		result = FChromaSDKPluginModule::Get().ChromaSDKCreateChromaLinkEffect(ChromaSDK::ChromaLink::CHROMA_CUSTOM, &pParam, &effectId);
 	}
 	break;
@@ -595,14 +435,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom1D(
 			break;
 		}
 		ChromaSDK::Headset::CUSTOM_EFFECT_TYPE pParam = {};
-		for (int i = 0; i < maxLeds; i++)
-		{
-			const FLinearColor& color = colors[i];
-			int red = color.R * 255;
-			int green = color.G * 255;
-			int blue = color.B * 255;
-			pParam.Color[i] = RGB(red, green, blue);
-		}
+		Color::ToBGR(colors.GetData(), pParam.Color, maxLeds);
 		result = FChromaSDKPluginModule::Get().ChromaSDKCreateHeadsetEffect(ChromaSDK::Headset::CHROMA_CUSTOM, &pParam, &effectId);
 	}
 	break;
@@ -617,14 +450,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom1D(
 			break;
 		}
 		ChromaSDK::Mousepad::CUSTOM_EFFECT_TYPE pParam = {};
-		for (int i = 0; i < maxLeds; i++)
-		{
-			const FLinearColor& color = colors[i];
-			int red = color.R * 255;
-			int green = color.G * 255;
-			int blue = color.B * 255;
-			pParam.Color[i] = RGB(red, green, blue);
-		}
+		Color::ToBGR(colors.GetData(), pParam.Color, maxLeds);
 		result = FChromaSDKPluginModule::Get().ChromaSDKCreateMousepadEffect(ChromaSDK::Mousepad::CHROMA_CUSTOM, &pParam, &effectId);
 	}
 	break;
@@ -670,15 +496,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom2D(
 		ChromaSDK::Keyboard::CUSTOM_EFFECT_TYPE pParam = {};
 		for (int i = 0; i < maxRow; i++)
 		{
-			const FChromaSDKColors& row = colors[i];
-			for (int j = 0; j < maxColumn; j++)
-			{
-				const FLinearColor& color = row.Colors[j];
-				int red = color.R * 255;
-				int green = color.G * 255;
-				int blue = color.B * 255;
-				pParam.Color[i][j] = RGB(red, green, blue);
-			}
+			Color::ToBGR(colors[i].Colors.GetData(), pParam.Color[i], maxColumn);
 		}
 		result = FChromaSDKPluginModule::Get().ChromaSDKCreateKeyboardEffect(ChromaSDK::Keyboard::CHROMA_CUSTOM, &pParam, &effectId);
 	}
@@ -701,15 +519,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom2D(
 		ChromaSDK::Keypad::CUSTOM_EFFECT_TYPE pParam = {};
 		for (int i = 0; i < maxRow; i++)
 		{
-			const FChromaSDKColors& row = colors[i];
-			for (int j = 0; j < maxColumn; j++)
-			{
-				const FLinearColor& color = row.Colors[j];
-				int red = color.R * 255;
-				int green = color.G * 255;
-				int blue = color.B * 255;
-				pParam.Color[i][j] = RGB(red, green, blue);
-			}
+			Color::ToBGR(colors[i].Colors.GetData(), pParam.Color[i], maxColumn);
 		}
 		result = FChromaSDKPluginModule::Get().ChromaSDKCreateKeypadEffect(ChromaSDK::Keypad::CHROMA_CUSTOM, &pParam, &effectId);
 	}
@@ -732,15 +542,7 @@ FChromaSDKEffectResult UChromaSDKPluginBPLibrary::ChromaSDKCreateEffectCustom2D(
 		ChromaSDK::Mouse::CUSTOM_EFFECT_TYPE2 pParam = {};
 		for (int i = 0; i < maxRow; i++)
 		{
-			const FChromaSDKColors& row = colors[i];
-			for (int j = 0; j < maxColumn; j++)
-			{
-				const FLinearColor& color = row.Colors[j];
-				int red = color.R * 255;
-				int green = color.G * 255;
-				int blue = color.B * 255;
-				pParam.Color[i][j] = RGB(red, green, blue);
-			}
+			Color::ToBGR(colors[i].Colors.GetData(), pParam.Color[i], maxColumn);
 		}
 		result = FChromaSDKPluginModule::Get().ChromaSDKCreateMouseEffect(ChromaSDK::Mouse::CHROMA_CUSTOM2, &pParam, &effectId);
 	}
@@ -831,6 +633,27 @@ void UChromaSDKPluginBPLibrary::CloseAnimationName(const FString& animationName)
 #endif
 }
 
+int UChromaSDKPluginBPLibrary::DuplicateAnimation(const int animationId)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().DuplicateAnimation(animationId);
+#else
+	return -1;
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::DuplicateAnimationName(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().DuplicateAnimationName(pathArg);
+#else
+	return -1;
+#endif
+}
+
 void UChromaSDKPluginBPLibrary::UnloadAnimation(const int animationId)
 {
 #if PLATFORM_WINDOWS
@@ -851,7 +674,7 @@ void UChromaSDKPluginBPLibrary::UnloadAnimationName(const FString& animationName
 void UChromaSDKPluginBPLibrary::SetKeyColor(int animationId, int frameIndex, const EChromaSDKKeyboardKey& key, const FLinearColor& color)
 {
 #if PLATFORM_WINDOWS
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		FChromaSDKPluginModule::Get().SetKeyColor(animationId, frameIndex, rzkey, FChromaSDKPluginModule::ToBGR(color));
@@ -865,7 +688,7 @@ void UChromaSDKPluginBPLibrary::SetKeyColorName(const FString& animationName, co
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		FChromaSDKPluginModule::Get().SetKeyColorName(pathArg, frameIndex, rzkey, FChromaSDKPluginModule::ToBGR(color));
@@ -877,16 +700,7 @@ void UChromaSDKPluginBPLibrary::SetKeyColorName(const FString& animationName, co
 void UChromaSDKPluginBPLibrary::SetKeysColor(int animationId, int frameIndex, const TArray<EChromaSDKKeyboardKey>& keys, const FLinearColor& color) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 {
 #if PLATFORM_WINDOWS
-	int colorArg = FChromaSDKPluginModule::ToBGR(color);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			FChromaSDKPluginModule::Get().SetKeyColor(animationId, frameIndex, rzkey, colorArg);
-		}
-	}
+	FChromaSDKPluginModule::Get().SetKeySetColor(animationId, frameIndex, CreateKeySet(keys), FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
@@ -897,23 +711,14 @@ void UChromaSDKPluginBPLibrary::SetKeysColorName(const FString& animationName, c
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	int colorArg = FChromaSDKPluginModule::ToBGR(color);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			FChromaSDKPluginModule::Get().SetKeyColorName(pathArg, frameIndex, rzkey, colorArg);
-		}
-	}
+	FChromaSDKPluginModule::Get().SetKeySetColorName(pathArg, frameIndex, CreateKeySet(keys), FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
 void UChromaSDKPluginBPLibrary::SetKeyColorAllFrames(int animationId, const EChromaSDKKeyboardKey& key, const FLinearColor& color)
 {
 #if PLATFORM_WINDOWS
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCount(animationId);
@@ -932,7 +737,7 @@ void UChromaSDKPluginBPLibrary::SetKeyColorAllFramesName(const FString& animatio
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCountName(pathArg);
@@ -949,20 +754,7 @@ void UChromaSDKPluginBPLibrary::SetKeyColorAllFramesName(const FString& animatio
 void UChromaSDKPluginBPLibrary::SetKeysColorAllFrames(int animationId, const TArray<EChromaSDKKeyboardKey>& keys, const FLinearColor& color) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 {
 #if PLATFORM_WINDOWS
-	int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCount(animationId);
-	int colorArg = FChromaSDKPluginModule::ToBGR(color);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
-			{
-				FChromaSDKPluginModule::Get().SetKeyColor(animationId, frameIndex, rzkey, colorArg);
-			}
-		}
-	}
+	FChromaSDKPluginModule::Get().SetKeySetColorAllFrames(animationId, CreateKeySet(keys), FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
@@ -973,27 +765,14 @@ void UChromaSDKPluginBPLibrary::SetKeysColorAllFramesName(const FString& animati
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCountName(pathArg);
-	int colorArg = FChromaSDKPluginModule::ToBGR(color);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
-			{
-				FChromaSDKPluginModule::Get().SetKeyColorName(pathArg, frameIndex, rzkey, colorArg);
-			}
-		}
-	}
+	FChromaSDKPluginModule::Get().SetKeySetColorAllFramesName(pathArg, CreateKeySet(keys), FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
 void UChromaSDKPluginBPLibrary::CopyKeyColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const EChromaSDKKeyboardKey& key)
 {
 #if PLATFORM_WINDOWS
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		FChromaSDKPluginModule::Get().CopyKeyColor(sourceAnimationId, targetAnimationId, frameIndex, rzkey);
@@ -1010,7 +789,7 @@ void UChromaSDKPluginBPLibrary::CopyKeyColorName(const FString& sourceAnimationN
 	FString targetPath = FPaths::GameContentDir();
 	targetPath += targetAnimationName + ".chroma";
 	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		FChromaSDKPluginModule::Get().CopyKeyColorName(sourcePathArg, targetPathArg, frameIndex, rzkey);
@@ -1022,15 +801,7 @@ void UChromaSDKPluginBPLibrary::CopyKeyColorName(const FString& sourceAnimationN
 void UChromaSDKPluginBPLibrary::CopyKeysColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const TArray<EChromaSDKKeyboardKey>& keys) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 {
 #if PLATFORM_WINDOWS
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			FChromaSDKPluginModule::Get().CopyKeyColor(sourceAnimationId, targetAnimationId, frameIndex, rzkey);
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyKeySetColor(sourceAnimationId, targetAnimationId, frameIndex, CreateKeySet(keys));
 #endif
 }
 
@@ -1044,15 +815,7 @@ void UChromaSDKPluginBPLibrary::CopyKeysColorName(const FString& sourceAnimation
 	FString targetPath = FPaths::GameContentDir();
 	targetPath += targetAnimationName + ".chroma";
 	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			FChromaSDKPluginModule::Get().CopyKeyColorName(sourcePathArg, targetPathArg, frameIndex, rzkey);
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyKeySetColorName(sourcePathArg, targetPathArg, frameIndex, CreateKeySet(keys));
 #endif
 }
 
@@ -1060,19 +823,7 @@ void UChromaSDKPluginBPLibrary::CopyKeysColorName(const FString& sourceAnimation
 void UChromaSDKPluginBPLibrary::CopyKeysColorAllFrames(int sourceAnimationId, int targetAnimationId, const TArray<EChromaSDKKeyboardKey>& keys) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 {
 #if PLATFORM_WINDOWS
-	int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCount(targetAnimationId);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
-			{
-				FChromaSDKPluginModule::Get().CopyKeyColor(sourceAnimationId, targetAnimationId, frameIndex, rzkey);
-			}
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyKeySetColorAllFrames(sourceAnimationId, targetAnimationId, CreateKeySet(keys));
 #endif
 }
 
@@ -1086,19 +837,7 @@ void UChromaSDKPluginBPLibrary::CopyKeysColorAllFramesName(const FString& source
 	FString targetPath = FPaths::GameContentDir();
 	targetPath += targetAnimationName + ".chroma";
 	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
-	int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCountName(targetPathArg);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
-			{
-				FChromaSDKPluginModule::Get().CopyKeyColorName(sourcePathArg, targetPathArg, frameIndex, rzkey);
-			}
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyKeySetColorAllFramesName(sourcePathArg, targetPathArg, CreateKeySet(keys));
 #endif
 }
 
@@ -1106,7 +845,7 @@ void UChromaSDKPluginBPLibrary::CopyKeysColorAllFramesName(const FString& source
 void UChromaSDKPluginBPLibrary::CopyNonZeroKeyColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const EChromaSDKKeyboardKey& key)
 {
 #if PLATFORM_WINDOWS
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		FChromaSDKPluginModule::Get().CopyNonZeroKeyColor(sourceAnimationId, targetAnimationId, frameIndex, rzkey);
@@ -1123,7 +862,7 @@ void UChromaSDKPluginBPLibrary::CopyNonZeroKeyColorName(const FString& sourceAni
 	FString targetPath = FPaths::GameContentDir();
 	targetPath += targetAnimationName + ".chroma";
 	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		FChromaSDKPluginModule::Get().CopyNonZeroKeyColorName(sourcePathArg, targetPathArg, frameIndex, rzkey);
@@ -1135,15 +874,7 @@ void UChromaSDKPluginBPLibrary::CopyNonZeroKeyColorName(const FString& sourceAni
 void UChromaSDKPluginBPLibrary::CopyNonZeroKeysColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const TArray<EChromaSDKKeyboardKey>& keys) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 {
 #if PLATFORM_WINDOWS
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			FChromaSDKPluginModule::Get().CopyNonZeroKeyColor(sourceAnimationId, targetAnimationId, frameIndex, rzkey);
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColor(sourceAnimationId, targetAnimationId, frameIndex, CreateKeySet(keys));
 #endif
 }
 
@@ -1157,15 +888,7 @@ void UChromaSDKPluginBPLibrary::CopyNonZeroKeysColorName(const FString& sourceAn
 	FString targetPath = FPaths::GameContentDir();
 	targetPath += targetAnimationName + ".chroma";
 	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			FChromaSDKPluginModule::Get().CopyNonZeroKeyColorName(sourcePathArg, targetPathArg, frameIndex, rzkey);
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColorName(sourcePathArg, targetPathArg, frameIndex, CreateKeySet(keys));
 #endif
 }
 
@@ -1173,19 +896,7 @@ void UChromaSDKPluginBPLibrary::CopyNonZeroKeysColorName(const FString& sourceAn
 void UChromaSDKPluginBPLibrary::CopyNonZeroKeysColorAllFrames(int sourceAnimationId, int targetAnimationId, const TArray<EChromaSDKKeyboardKey>& keys) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 {
 #if PLATFORM_WINDOWS
-	int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCount(targetAnimationId);
-	for (int k = 0; k < keys.Num(); ++k)
-	{
-		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
-			{
-				FChromaSDKPluginModule::Get().CopyNonZeroKeyColor(sourceAnimationId, targetAnimationId, frameIndex, rzkey);
-			}
-		}
-	}
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColorAllFrames(sourceAnimationId, targetAnimationId, CreateKeySet(keys));
 #endif
 }
 
@@ -1199,229 +910,939 @@ void UChromaSDKPluginBPLibrary::CopyNonZeroKeysColorAllFramesName(const FString&
 	FString targetPath = FPaths::GameContentDir();
 	targetPath += targetAnimationName + ".chroma";
 	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
-	int frameCount = FChromaSDKPluginModule::Get().GetAnimationFrameCountName(targetPathArg);
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColorAllFramesName(sourcePathArg, targetPathArg, CreateKeySet(keys));
+#endif
+}
+
+//FChromaSDKKeySet UChromaSDKPluginBPLibrary::CreateKeySet(const TArray<TEnumAsByte<EChromaSDKKeyboardKey>>& keys) //(support 4.13 and below)___HACK_UE4_WANTS_GAME_MODE
+FChromaSDKKeySet UChromaSDKPluginBPLibrary::CreateKeySet(const TArray<EChromaSDKKeyboardKey>& keys) //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
+{
+	FChromaSDKKeySet keySet;
+#if PLATFORM_WINDOWS
 	for (int k = 0; k < keys.Num(); ++k)
 	{
 		EChromaSDKKeyboardKey key = keys[k];
-		int rzkey = _sKeyboardEnumMap[key];
-		if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
-		{
-			for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
-			{
-				FChromaSDKPluginModule::Get().CopyNonZeroKeyColorName(sourcePathArg, targetPathArg, frameIndex, rzkey);
-			}
-		}
+		keySet.Add(KeyMap::GetKeyboardLocation(key).Index);
 	}
 #endif
+	return keySet;
 }
 
-
-void UChromaSDKPluginBPLibrary::PlayAnimation(const FString& animationName, bool loop)
+void UChromaSDKPluginBPLibrary::SetKeySetColor(int animationId, int frameIndex, const FChromaSDKKeySet& keySet, const FLinearColor& color)
 {
 #if PLATFORM_WINDOWS
-	FString path = FPaths::GameContentDir();
-	path += animationName + ".chroma";
-	//UE_LOG(LogTemp, Log, TEXT("PlayAnimation: %s"), *path);
-	const char* pathArg = TCHAR_TO_ANSI(*path);
-	FChromaSDKPluginModule::Get().PlayAnimationName(pathArg, loop);
+	FChromaSDKPluginModule::Get().SetKeySetColor(animationId, frameIndex, keySet, FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
-void UChromaSDKPluginBPLibrary::StopAnimation(const FString& animationName)
+void UChromaSDKPluginBPLibrary::SetKeySetColorName(const FString& animationName, const int frameIndex, const FChromaSDKKeySet& keySet, const FLinearColor& color)
 {
 #if PLATFORM_WINDOWS
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
-	//UE_LOG(LogTemp, Log, TEXT("StopAnimation: %s"), *path);
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	FChromaSDKPluginModule::Get().StopAnimationName(pathArg);
+	FChromaSDKPluginModule::Get().SetKeySetColorName(pathArg, frameIndex, keySet, FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
-void UChromaSDKPluginBPLibrary::StopAnimationType(const EChromaSDKDeviceEnum& device)
+void UChromaSDKPluginBPLibrary::SetKeySetColorAllFrames(int animationId, const FChromaSDKKeySet& keySet, const FLinearColor& color)
 {
 #if PLATFORM_WINDOWS
-	switch (device)
-	{
-	case EChromaSDKDeviceEnum::DE_ChromaLink:
-		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_ChromaLink);
-		break;
-	case EChromaSDKDeviceEnum::DE_Headset:
-		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Headset);
-		break;
-	case EChromaSDKDeviceEnum::DE_Keyboard:
-		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keyboard);
-		break;
-	case EChromaSDKDeviceEnum::DE_Keypad:
-		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keypad);
-		break;
-	case EChromaSDKDeviceEnum::DE_Mouse:
-		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Mouse);
-		break;
-	case EChromaSDKDeviceEnum::DE_Mousepad:
-		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Mousepad);
-		break;
-	}
+	FChromaSDKPluginModule::Get().SetKeySetColorAllFrames(animationId, keySet, FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
-void UChromaSDKPluginBPLibrary::StopAll()
+void UChromaSDKPluginBPLibrary::SetKeySetColorAllFramesName(const FString& animationName, const FChromaSDKKeySet& keySet, const FLinearColor& color)
 {
 #if PLATFORM_WINDOWS
-	StopAnimationType(EChromaSDKDeviceEnum::DE_ChromaLink);
-	StopAnimationType(EChromaSDKDeviceEnum::DE_Headset);
-	StopAnimationType(EChromaSDKDeviceEnum::DE_Keyboard);
-	StopAnimationType(EChromaSDKDeviceEnum::DE_Keypad);
-	StopAnimationType(EChromaSDKDeviceEnum::DE_Mouse);
-	StopAnimationType(EChromaSDKDeviceEnum::DE_Mousepad);
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().SetKeySetColorAllFramesName(pathArg, keySet, FChromaSDKPluginModule::ToBGR(color));
 #endif
 }
 
-void UChromaSDKPluginBPLibrary::ClearAnimationType(const EChromaSDKDeviceEnum& device)
+void UChromaSDKPluginBPLibrary::CopyKeySetColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	StopAnimationType(device);
-
-	FChromaSDKEffectResult result = ChromaSDKCreateEffectNone(device);
-	if (result.Result == 0)
-	{
-		ChromaSDKSetEffect(result.EffectId);
-		ChromaSDKDeleteEffect(result.EffectId);
-	}
+	FChromaSDKPluginModule::Get().CopyKeySetColor(sourceAnimationId, targetAnimationId, frameIndex, keySet);
 #endif
 }
 
-void UChromaSDKPluginBPLibrary::ClearAll()
+void UChromaSDKPluginBPLibrary::CopyKeySetColorName(const FString& sourceAnimationName, const FString& targetAnimationName, const int frameIndex, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	ClearAnimationType(EChromaSDKDeviceEnum::DE_ChromaLink);
-	ClearAnimationType(EChromaSDKDeviceEnum::DE_Headset);
-	ClearAnimationType(EChromaSDKDeviceEnum::DE_Keyboard);
-	ClearAnimationType(EChromaSDKDeviceEnum::DE_Keypad);
-	ClearAnimationType(EChromaSDKDeviceEnum::DE_Mouse);
-	ClearAnimationType(EChromaSDKDeviceEnum::DE_Mousepad);
+	FString sourcePath = FPaths::GameContentDir();
+	sourcePath += sourceAnimationName + ".chroma";
+	const char* sourcePathArg = TCHAR_TO_ANSI(*sourcePath);
+	FString targetPath = FPaths::GameContentDir();
+	targetPath += targetAnimationName + ".chroma";
+	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
+	FChromaSDKPluginModule::Get().CopyKeySetColorName(sourcePathArg, targetPathArg, frameIndex, keySet);
 #endif
 }
 
-int UChromaSDKPluginBPLibrary::GetAnimationCount()
+void UChromaSDKPluginBPLibrary::CopyKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	return FChromaSDKPluginModule::Get().GetAnimationCount();
-#else
-	return -1;
+	FChromaSDKPluginModule::Get().CopyKeySetColorAllFrames(sourceAnimationId, targetAnimationId, keySet);
 #endif
 }
 
-int UChromaSDKPluginBPLibrary::GetAnimationIdByIndex(int index)
+void UChromaSDKPluginBPLibrary::CopyKeySetColorAllFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	return FChromaSDKPluginModule::Get().GetAnimationId(index);
-#else
-	return -1;
+	FString sourcePath = FPaths::GameContentDir();
+	sourcePath += sourceAnimationName + ".chroma";
+	const char* sourcePathArg = TCHAR_TO_ANSI(*sourcePath);
+	FString targetPath = FPaths::GameContentDir();
+	targetPath += targetAnimationName + ".chroma";
+	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
+	FChromaSDKPluginModule::Get().CopyKeySetColorAllFramesName(sourcePathArg, targetPathArg, keySet);
 #endif
 }
 
-int UChromaSDKPluginBPLibrary::GetPlayingAnimationCount()
+void UChromaSDKPluginBPLibrary::CopyNonZeroKeySetColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	return FChromaSDKPluginModule::Get().GetPlayingAnimationCount();
-#else
-	return -1;
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColor(sourceAnimationId, targetAnimationId, frameIndex, keySet);
 #endif
 }
 
-int UChromaSDKPluginBPLibrary::GetPlayingAnimationId(int index)
+void UChromaSDKPluginBPLibrary::CopyNonZeroKeySetColorName(const FString& sourceAnimationName, const FString& targetAnimationName, const int frameIndex, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	return FChromaSDKPluginModule::Get().GetPlayingAnimationId(index);
-#else
-	return -1;
+	FString sourcePath = FPaths::GameContentDir();
+	sourcePath += sourceAnimationName + ".chroma";
+	const char* sourcePathArg = TCHAR_TO_ANSI(*sourcePath);
+	FString targetPath = FPaths::GameContentDir();
+	targetPath += targetAnimationName + ".chroma";
+	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColorName(sourcePathArg, targetPathArg, frameIndex, keySet);
 #endif
 }
 
-bool UChromaSDKPluginBPLibrary::IsAnimationTypePlaying(const EChromaSDKDeviceEnum& device)
+void UChromaSDKPluginBPLibrary::CopyNonZeroKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	switch (device)
-	{
-	case EChromaSDKDeviceEnum::DE_ChromaLink:
-		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_ChromaLink);
-	case EChromaSDKDeviceEnum::DE_Headset:
-		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Headset);
-	case EChromaSDKDeviceEnum::DE_Keyboard:
-		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keyboard);
-	case EChromaSDKDeviceEnum::DE_Keypad:
-		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keypad);
-	case EChromaSDKDeviceEnum::DE_Mouse:
-		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Mouse);
-	case EChromaSDKDeviceEnum::DE_Mousepad:
-		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Mousepad);
-	}
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColorAllFrames(sourceAnimationId, targetAnimationId, keySet);
 #endif
-	return false;
 }
 
-int UChromaSDKPluginBPLibrary::GetFrameCount(const int animationId)
+void UChromaSDKPluginBPLibrary::CopyNonZeroKeySetColorAllFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, const FChromaSDKKeySet& keySet)
 {
 #if PLATFORM_WINDOWS
-	return FChromaSDKPluginModule::Get().GetAnimationFrameCount(animationId);
-#else
-	return -1;
+	FString sourcePath = FPaths::GameContentDir();
+	sourcePath += sourceAnimationName + ".chroma";
+	const char* sourcePathArg = TCHAR_TO_ANSI(*sourcePath);
+	FString targetPath = FPaths::GameContentDir();
+	targetPath += targetAnimationName + ".chroma";
+	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
+	FChromaSDKPluginModule::Get().CopyNonZeroKeySetColorAllFramesName(sourcePathArg, targetPathArg, keySet);
 #endif
 }
 
-int UChromaSDKPluginBPLibrary::GetFrameCountName(const FString& animationName)
+
+void UChromaSDKPluginBPLibrary::PlayAnimation(const FString& animationName, bool loop)
 {
 #if PLATFORM_WINDOWS
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
-	//UE_LOG(LogTemp, Log, TEXT("StopAnimation: %s"), *path);
+	//UE_LOG(LogTemp, Log, TEXT("PlayAnimation: %s"), *path);
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	return FChromaSDKPluginModule::Get().GetAnimationFrameCountName(pathArg);
-#else
-	return -1;
+	FChromaSDKPluginModule::Get().PlayAnimationName(pathArg, loop);
 #endif
 }
 
-bool UChromaSDKPluginBPLibrary::IsAnimationPlaying(const FString& animationName)
+void UChromaSDKPluginBPLibrary::StopAnimation(const FString& animationName)
 {
 #if PLATFORM_WINDOWS
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
-	//UE_LOG(LogTemp, Log, TEXT("IsAnimationPlaying: %s"), *path);
+	//UE_LOG(LogTemp, Log, TEXT("StopAnimation: %s"), *path);
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	return FChromaSDKPluginModule::Get().IsAnimationPlayingName(pathArg);
-#else
-	return false;
+	FChromaSDKPluginModule::Get().StopAnimationName(pathArg);
 #endif
 }
 
-void UChromaSDKPluginBPLibrary::PlayAnimations(const TArray<FString>& animationNames, bool loop)
+void UChromaSDKPluginBPLibrary::PlayAnimationId(const int animationId, bool loop)
 {
-	for (int i = 0; i < animationNames.Num(); ++i)
-	{
-		PlayAnimation(animationNames[i], loop);
-	}
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().PlayAnimation(animationId, loop);
+#endif
 }
 
-void UChromaSDKPluginBPLibrary::StopAnimations(const TArray<FString>& animationNames)
+void UChromaSDKPluginBPLibrary::StopAnimationId(const int animationId)
 {
-	for (int i = 0; i < animationNames.Num(); ++i)
-	{
-		StopAnimation(animationNames[i]);
-	}
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().StopAnimation(animationId);
+#endif
 }
 
-void UChromaSDKPluginBPLibrary::PlayAnimationComposite(const FString& animationName, bool loop)
+int UChromaSDKPluginBPLibrary::CreateInstanceName(const FString& animationName)
 {
-	PlayAnimation(animationName + "_ChromaLink", loop);
-	PlayAnimation(animationName + "_Headset", loop);
-	PlayAnimation(animationName + "_Keyboard", loop);
-	PlayAnimation(animationName + "_Keypad", loop);
-	PlayAnimation(animationName + "_Mouse", loop);
-	PlayAnimation(animationName + "_Mousepad", loop);
-}
-
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().CreateInstanceName(pathArg);
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::DestroyInstance(const int instanceId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().DestroyInstance(instanceId);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::PlayInstance(const int instanceId, bool loop)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().PlayInstance(instanceId, loop);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopInstance(const int instanceId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().StopInstance(instanceId);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetInstanceSpeed(const int instanceId, float speed)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetInstanceSpeed(instanceId, speed);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetInstanceIntensity(const int instanceId, float intensity)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetInstanceIntensity(instanceId, intensity);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetInstanceOffset(const int instanceId, int rowOffset, int columnOffset)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetInstanceOffset(instanceId, rowOffset, columnOffset);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetInstanceDevice(const int instanceId, const EChromaSDKDeviceEnum& device)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetInstanceDevice(instanceId, (int)device);
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::CreateSequence()
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().CreateSequence();
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::DestroySequence(const int sequenceId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().DestroySequence(sequenceId);
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::AddSequenceItem(const int sequenceId, const FString& animationName, int loopCount)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().AddSequenceItemName(sequenceId, pathArg, loopCount);
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ClearSequence(const int sequenceId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().ClearSequence(sequenceId);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::PlaySequence(const int sequenceId, bool loop)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().PlaySequence(sequenceId, loop);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopSequence(const int sequenceId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().StopSequence(sequenceId);
+#endif
+}
+
+bool UChromaSDKPluginBPLibrary::IsSequencePlaying(const int sequenceId)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().IsSequencePlaying(sequenceId);
+#else
+	return false;
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::CreateStateMachine(const TArray<FChromaSDKLightingState>& states, const TArray<FChromaSDKLightingTransition>& transitions)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule& module = FChromaSDKPluginModule::Get();
+	int stateMachineId = module.CreateStateMachine();
+	for (int i = 0; i < states.Num(); ++i)
+	{
+		const FChromaSDKLightingState& state = states[i];
+		int stateIndex = module.AddStateMachineState(stateMachineId, state.Loop);
+		for (int j = 0; j < state.Animations.Num(); ++j)
+		{
+			FString path = FPaths::GameContentDir();
+			path += state.Animations[j] + ".chroma";
+			const char* pathArg = TCHAR_TO_ANSI(*path);
+			module.AddStateMachineAnimationName(stateMachineId, stateIndex, pathArg);
+		}
+	}
+	for (int i = 0; i < transitions.Num(); ++i)
+	{
+		const FChromaSDKLightingTransition& transition = transitions[i];
+		module.AddStateMachineTransition(stateMachineId, transition.FromState, transition.ToState,
+			transition.Parameter, (int)transition.Compare, transition.Value, transition.BlendTime, (int)transition.Transition);
+	}
+	return stateMachineId;
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::DestroyStateMachine(const int stateMachineId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().DestroyStateMachine(stateMachineId);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::PlayStateMachine(const int stateMachineId, int state)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().PlayStateMachine(stateMachineId, state);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopStateMachine(const int stateMachineId)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().StopStateMachine(stateMachineId);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetStateMachineParameter(const int stateMachineId, int parameter, float value)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetStateMachineParameter(stateMachineId, parameter, value);
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::GetStateMachineState(const int stateMachineId)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().GetStateMachineState(stateMachineId);
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::BindAnimationEvents(const FString& animationName, const FDelegateChromaSDKAnimationEvent& onEvent)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule& module = FChromaSDKPluginModule::Get();
+	int animationId = module.GetAnimation(pathArg);
+	if (animationId < 0 ||
+		module.GetEventDispatcher() == nullptr)
+	{
+		return;
+	}
+	module.GetEventDispatcher()->Bind(animationId, animationName, onEvent);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::UnbindAnimationEvents(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FChromaEventDispatcher* dispatcher = FChromaSDKPluginModule::Get().GetEventDispatcher();
+	if (dispatcher != nullptr)
+	{
+		dispatcher->UnbindName(animationName);
+	}
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::RetargetAnimationName(const FString& animationName, const EChromaSDKDeviceEnum& device, const EChromaSDKRetargetKernel& kernel)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().RetargetAnimationName(pathArg, (int)device, (int)kernel);
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::PlayAnimationRetargeted(const FString& animationName, bool loop)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().PlayAnimationRetargetedName(pathArg, loop);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopAnimationRetargeted(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().StopAnimationRetargetedName(pathArg);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::PlayAnimationTransition(const FString& animationName, bool loop, const EChromaSDKTransitionEnum& transition, float duration)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().PlayAnimationTransitionName(pathArg, loop, (int)transition, duration);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopAnimationType(const EChromaSDKDeviceEnum& device)
+{
+#if PLATFORM_WINDOWS
+	switch (device)
+	{
+	case EChromaSDKDeviceEnum::DE_ChromaLink:
+		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_ChromaLink);
+		break;
+	case EChromaSDKDeviceEnum::DE_Headset:
+		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Headset);
+		break;
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keyboard);
+		break;
+	case EChromaSDKDeviceEnum::DE_Keypad:
+		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keypad);
+		break;
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Mouse);
+		break;
+	case EChromaSDKDeviceEnum::DE_Mousepad:
+		FChromaSDKPluginModule::Get().StopAnimationType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Mousepad);
+		break;
+	}
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopAll()
+{
+#if PLATFORM_WINDOWS
+	StopAnimationType(EChromaSDKDeviceEnum::DE_ChromaLink);
+	StopAnimationType(EChromaSDKDeviceEnum::DE_Headset);
+	StopAnimationType(EChromaSDKDeviceEnum::DE_Keyboard);
+	StopAnimationType(EChromaSDKDeviceEnum::DE_Keypad);
+	StopAnimationType(EChromaSDKDeviceEnum::DE_Mouse);
+	StopAnimationType(EChromaSDKDeviceEnum::DE_Mousepad);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ClearAnimationType(const EChromaSDKDeviceEnum& device)
+{
+#if PLATFORM_WINDOWS
+	StopAnimationType(device);
+
+	FChromaSDKEffectResult result = ChromaSDKCreateEffectNone(device);
+	if (result.Result == 0)
+	{
+		ChromaSDKSetEffect(result.EffectId);
+		ChromaSDKDeleteEffect(result.EffectId);
+	}
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ClearAll()
+{
+#if PLATFORM_WINDOWS
+	ClearAnimationType(EChromaSDKDeviceEnum::DE_ChromaLink);
+	ClearAnimationType(EChromaSDKDeviceEnum::DE_Headset);
+	ClearAnimationType(EChromaSDKDeviceEnum::DE_Keyboard);
+	ClearAnimationType(EChromaSDKDeviceEnum::DE_Keypad);
+	ClearAnimationType(EChromaSDKDeviceEnum::DE_Mouse);
+	ClearAnimationType(EChromaSDKDeviceEnum::DE_Mousepad);
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::GetAnimationCount()
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().GetAnimationCount();
+#else
+	return -1;
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::GetAnimationIdByIndex(int index)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().GetAnimationId(index);
+#else
+	return -1;
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::GetPlayingAnimationCount()
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().GetPlayingAnimationCount();
+#else
+	return -1;
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::GetPlayingAnimationId(int index)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().GetPlayingAnimationId(index);
+#else
+	return -1;
+#endif
+}
+
+bool UChromaSDKPluginBPLibrary::IsAnimationTypePlaying(const EChromaSDKDeviceEnum& device)
+{
+#if PLATFORM_WINDOWS
+	switch (device)
+	{
+	case EChromaSDKDeviceEnum::DE_ChromaLink:
+		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_ChromaLink);
+	case EChromaSDKDeviceEnum::DE_Headset:
+		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Headset);
+	case EChromaSDKDeviceEnum::DE_Keyboard:
+		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keyboard);
+	case EChromaSDKDeviceEnum::DE_Keypad:
+		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Keypad);
+	case EChromaSDKDeviceEnum::DE_Mouse:
+		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_2D, (int)EChromaSDKDevice2DEnum::DE_Mouse);
+	case EChromaSDKDeviceEnum::DE_Mousepad:
+		return FChromaSDKPluginModule::Get().IsAnimationPlayingType((int)EChromaSDKDeviceTypeEnum::DE_1D, (int)EChromaSDKDevice1DEnum::DE_Mousepad);
+	}
+#endif
+	return false;
+}
+
+int UChromaSDKPluginBPLibrary::GetFrameCount(const int animationId)
+{
+#if PLATFORM_WINDOWS
+	return FChromaSDKPluginModule::Get().GetAnimationFrameCount(animationId);
+#else
+	return -1;
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::GetFrameCountName(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	//UE_LOG(LogTemp, Log, TEXT("StopAnimation: %s"), *path);
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().GetAnimationFrameCountName(pathArg);
+#else
+	return -1;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::FillFrames(int animationId, int startFrame, int endFrame, const FLinearColor& color)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().FillFrames(animationId, startFrame, endFrame, FChromaSDKPluginModule::ToBGR(color));
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::FillFramesName(const FString& animationName, int startFrame, int endFrame, const FLinearColor& color)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().FillFramesName(pathArg, startFrame, endFrame, FChromaSDKPluginModule::ToBGR(color));
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::MultiplyFrames(int animationId, int startFrame, int endFrame, float intensity)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().MultiplyFrames(animationId, startFrame, endFrame, intensity);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::MultiplyFramesName(const FString& animationName, int startFrame, int endFrame, float intensity)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().MultiplyFramesName(pathArg, startFrame, endFrame, intensity);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ShiftFrames(int animationId, int startFrame, int endFrame, int rowOffset, int columnOffset)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().ShiftFrames(animationId, startFrame, endFrame, rowOffset, columnOffset);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ShiftFramesName(const FString& animationName, int startFrame, int endFrame, int rowOffset, int columnOffset)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().ShiftFramesName(pathArg, startFrame, endFrame, rowOffset, columnOffset);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ReverseFrames(int animationId, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().ReverseFrames(animationId, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ReverseFramesName(const FString& animationName, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().ReverseFramesName(pathArg, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::DuplicateFrames(int animationId, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().DuplicateFrames(animationId, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::DuplicateFramesName(const FString& animationName, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().DuplicateFramesName(pathArg, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::TrimFrames(int animationId, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().TrimFrames(animationId, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::TrimFramesName(const FString& animationName, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().TrimFramesName(pathArg, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ReplaceColor(int animationId, const FLinearColor& color, const FLinearColor& newColor)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().ReplaceColor(animationId, FChromaSDKPluginModule::ToBGR(color), FChromaSDKPluginModule::ToBGR(newColor));
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::ReplaceColorName(const FString& animationName, const FLinearColor& color, const FLinearColor& newColor)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().ReplaceColorName(pathArg, FChromaSDKPluginModule::ToBGR(color), FChromaSDKPluginModule::ToBGR(newColor));
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CopyFramesRegion(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().CopyFramesRegion(sourceAnimationId, targetAnimationId, startFrame, endFrame, startRow, startColumn, rows, columns);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CopyFramesRegionName(const FString& sourceAnimationName, const FString& targetAnimationName, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns)
+{
+#if PLATFORM_WINDOWS
+	FString sourcePath = FPaths::GameContentDir();
+	sourcePath += sourceAnimationName + ".chroma";
+	const char* sourcePathArg = TCHAR_TO_ANSI(*sourcePath);
+	FString targetPath = FPaths::GameContentDir();
+	targetPath += targetAnimationName + ".chroma";
+	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
+	FChromaSDKPluginModule::Get().CopyFramesRegionName(sourcePathArg, targetPathArg, startFrame, endFrame, startRow, startColumn, rows, columns);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CopyNonZeroFrames(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().CopyNonZeroFrames(sourceAnimationId, targetAnimationId, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CopyNonZeroFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, int startFrame, int endFrame)
+{
+#if PLATFORM_WINDOWS
+	FString sourcePath = FPaths::GameContentDir();
+	sourcePath += sourceAnimationName + ".chroma";
+	const char* sourcePathArg = TCHAR_TO_ANSI(*sourcePath);
+	FString targetPath = FPaths::GameContentDir();
+	targetPath += targetAnimationName + ".chroma";
+	const char* targetPathArg = TCHAR_TO_ANSI(*targetPath);
+	FChromaSDKPluginModule::Get().CopyNonZeroFramesName(sourcePathArg, targetPathArg, startFrame, endFrame);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CanvasFill(const EChromaSDKDeviceEnum& device, const FLinearColor& color)
+{
+#if PLATFORM_WINDOWS
+	ChromaCanvas* canvas = ChromaThread::Instance()->GetCanvas(device);
+	if (canvas == nullptr)
+	{
+		return;
+	}
+	COLORREF* buffer = canvas->GetBackBuffer();
+	COLORREF colorArg = FChromaSDKPluginModule::ToBGR(color);
+	int size = canvas->GetSize();
+	for (int i = 0; i < size; ++i)
+	{
+		buffer[i] = colorArg;
+	}
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CanvasSetColors1D(const EChromaSDKDevice1DEnum& device, const TArray<FLinearColor>& colors)
+{
+#if PLATFORM_WINDOWS
+	ChromaCanvas* canvas = ChromaThread::Instance()->GetCanvas(ChromaCanvas::ToDevice(device));
+	if (canvas == nullptr)
+	{
+		return;
+	}
+	COLORREF* buffer = canvas->GetBackBuffer();
+	int size = FMath::Min(canvas->GetSize(), colors.Num());
+	Color::ToBGR(colors.GetData(), buffer, size);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CanvasSetColors2D(const EChromaSDKDevice2DEnum& device, const TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	ChromaCanvas* canvas = ChromaThread::Instance()->GetCanvas(ChromaCanvas::ToDevice(device));
+	if (canvas == nullptr)
+	{
+		return;
+	}
+	COLORREF* buffer = canvas->GetBackBuffer();
+	int maxRow = FMath::Min(canvas->GetMaxRow(), colors.Num());
+	int maxColumn = canvas->GetMaxColumn();
+	for (int i = 0; i < maxRow; ++i)
+	{
+		const TArray<FLinearColor>& row = colors[i].Colors;
+		int columns = FMath::Min(maxColumn, row.Num());
+		Color::ToBGR(row.GetData(), buffer + i * maxColumn, columns);
+	}
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CanvasSetKeyColor(const EChromaSDKKeyboardKey& key, const FLinearColor& color)
+{
+#if PLATFORM_WINDOWS
+	const KeyMap::FKeyLocation& location = KeyMap::GetKeyboardLocation(key);
+	if (location.RzKey == ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
+	{
+		return;
+	}
+	ChromaCanvas* canvas = ChromaThread::Instance()->GetCanvas(EChromaSDKDeviceEnum::DE_Keyboard);
+	if (canvas == nullptr)
+	{
+		return;
+	}
+	canvas->GetBackBuffer()[location.Index] = FChromaSDKPluginModule::ToBGR(color);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CanvasCommit(const EChromaSDKDeviceEnum& device)
+{
+#if PLATFORM_WINDOWS
+	ChromaCanvas* canvas = ChromaThread::Instance()->GetCanvas(device);
+	if (canvas == nullptr)
+	{
+		return;
+	}
+	canvas->Commit();
+#endif
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::DrawRect2D(int row, int column, int rows, int columns, const FLinearColor& color, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::Rect(Draw::MakeGrid(colors), row, column, rows, columns, color);
+#endif
+	return colors;
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::DrawHorizontalBar2D(int row, int rows, float amount, const FLinearColor& color, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::HorizontalBar(Draw::MakeGrid(colors), row, rows, amount, color);
+#endif
+	return colors;
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::DrawVerticalBar2D(int column, int columns, float amount, const FLinearColor& color, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::VerticalBar(Draw::MakeGrid(colors), column, columns, amount, color);
+#endif
+	return colors;
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::DrawLine2D(int startRow, int startColumn, int endRow, int endColumn, const FLinearColor& color, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::Line(Draw::MakeGrid(colors), startRow, startColumn, endRow, endColumn, color);
+#endif
+	return colors;
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::DrawCircle2D(float centerRow, float centerColumn, float radius, const FLinearColor& color, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::Circle(Draw::MakeGrid(colors), centerRow, centerColumn, radius, color);
+#endif
+	return colors;
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::DrawGradient2D(int row, int column, int rows, int columns, const FLinearColor& startColor, const FLinearColor& endColor, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::Gradient(Draw::MakeGrid(colors), row, column, rows, columns, startColor, endColor);
+#endif
+	return colors;
+}
+
+const TArray<FChromaSDKColors>& UChromaSDKPluginBPLibrary::FloodFill2D(int row, int column, const FLinearColor& color, TArray<FChromaSDKColors>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::FloodFill(Draw::MakeGrid(colors), row, column, color);
+#endif
+	return colors;
+}
+
+const TArray<FLinearColor>& UChromaSDKPluginBPLibrary::DrawBar1D(float amount, const FLinearColor& color, TArray<FLinearColor>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::HorizontalBar(Draw::MakeStrip(colors), 0, 1, amount, color);
+#endif
+	return colors;
+}
+
+const TArray<FLinearColor>& UChromaSDKPluginBPLibrary::DrawGradient1D(int start, int count, const FLinearColor& startColor, const FLinearColor& endColor, TArray<FLinearColor>& colors)
+{
+#if PLATFORM_WINDOWS
+	Draw::Gradient(Draw::MakeStrip(colors), 0, start, 1, count, startColor, endColor);
+#endif
+	return colors;
+}
+
+bool UChromaSDKPluginBPLibrary::IsAnimationPlaying(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	//UE_LOG(LogTemp, Log, TEXT("IsAnimationPlaying: %s"), *path);
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().IsAnimationPlayingName(pathArg);
+#else
+	return false;
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::PlayAnimations(const TArray<FString>& animationNames, bool loop)
+{
+#if PLATFORM_WINDOWS
+	//resolve every animation first so the group starts on one tick
+	TArray<int> animationIds;
+	for (int i = 0; i < animationNames.Num(); ++i)
+	{
+		FString path = FPaths::GameContentDir();
+		path += animationNames[i] + ".chroma";
+		int animationId = FChromaSDKPluginModule::Get().GetAnimation(TCHAR_TO_ANSI(*path));
+		if (animationId >= 0)
+		{
+			animationIds.Add(animationId);
+		}
+	}
+	FChromaSDKPluginModule::Get().PlayAnimations(animationIds.GetData(), animationIds.Num(), loop);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopAnimations(const TArray<FString>& animationNames)
+{
+	for (int i = 0; i < animationNames.Num(); ++i)
+	{
+		StopAnimation(animationNames[i]);
+	}
+}
+
+void UChromaSDKPluginBPLibrary::PlayAnimationComposite(const FString& animationName, bool loop)
+{
+	TArray<FString> animationNames;
+	animationNames.Add(animationName + "_ChromaLink");
+	animationNames.Add(animationName + "_Headset");
+	animationNames.Add(animationName + "_Keyboard");
+	animationNames.Add(animationName + "_Keypad");
+	animationNames.Add(animationName + "_Mouse");
+	animationNames.Add(animationName + "_Mousepad");
+	PlayAnimations(animationNames, loop);
+}
+
 void UChromaSDKPluginBPLibrary::StopAnimationComposite(const FString& animationName)
 {
 	StopAnimation(animationName + "_ChromaLink");
@@ -1432,11 +1853,127 @@ void UChromaSDKPluginBPLibrary::StopAnimationComposite(const FString& animationN
 	StopAnimation(animationName + "_Mousepad");
 }
 
+void UChromaSDKPluginBPLibrary::PlayComposite(const FString& animationName, bool loop)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().PlayCompositeName(pathArg, loop);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::StopComposite(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().StopCompositeName(pathArg);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::CloseComposite(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	FChromaSDKPluginModule::Get().CloseCompositeName(pathArg);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetPlaybackTimeScale(float timeScale)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetPlaybackTimeScale(timeScale);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetPlaybackPaused(bool paused)
+{
+#if PLATFORM_WINDOWS
+	FChromaSDKPluginModule::Get().SetPlaybackPaused(paused);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetAnimationTimeScale(const FString& animationName, float timeScale)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	int animationId = FChromaSDKPluginModule::Get().GetAnimation(pathArg);
+	FChromaSDKPluginModule::Get().SetAnimationTimeScale(animationId, timeScale);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetAnimationPaused(const FString& animationName, bool paused)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	int animationId = FChromaSDKPluginModule::Get().GetAnimation(pathArg);
+	FChromaSDKPluginModule::Get().SetAnimationPaused(animationId, paused);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetCompositeTimeScale(const FString& animationName, float timeScale)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	int compositeId = FChromaSDKPluginModule::Get().GetComposite(pathArg);
+	FChromaSDKPluginModule::Get().SetCompositeTimeScale(compositeId, timeScale);
+#endif
+}
+
+void UChromaSDKPluginBPLibrary::SetCompositePaused(const FString& animationName, bool paused)
+{
+#if PLATFORM_WINDOWS
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	int compositeId = FChromaSDKPluginModule::Get().GetComposite(pathArg);
+	FChromaSDKPluginModule::Get().SetCompositePaused(compositeId, paused);
+#endif
+}
+
+int UChromaSDKPluginBPLibrary::SaveComposite(const FString& animationName)
+{
+#if PLATFORM_WINDOWS
+	const FString suffixes[] = { "_ChromaLink", "_Headset", "_Keyboard", "_Keypad", "_Mouse", "_Mousepad" };
+	TArray<int> animationIds;
+	for (int i = 0; i < 6; ++i)
+	{
+		FString path = FPaths::GameContentDir();
+		path += animationName + suffixes[i] + ".chroma";
+		if (!FPaths::FileExists(path))
+		{
+			continue;
+		}
+		int animationId = FChromaSDKPluginModule::Get().GetAnimation(TCHAR_TO_ANSI(*path));
+		if (animationId >= 0)
+		{
+			animationIds.Add(animationId);
+		}
+	}
+	FString path = FPaths::GameContentDir();
+	path += animationName + ".chroma";
+	const char* pathArg = TCHAR_TO_ANSI(*path);
+	return FChromaSDKPluginModule::Get().SaveComposite(pathArg, animationIds.GetData(), animationIds.Num());
+#else
+	return -1;
+#endif
+}
+
 FLinearColor UChromaSDKPluginBPLibrary::GetKeyColor(int animationId, int frameIndex,
 	const EChromaSDKKeyboardKey& key)
 {
 #if PLATFORM_WINDOWS
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		int color = FChromaSDKPluginModule::Get().GetKeyColor(animationId, frameIndex, rzkey);
@@ -1453,7 +1990,7 @@ FLinearColor UChromaSDKPluginBPLibrary::GetKeyColorName(const FString& animation
 	FString path = FPaths::GameContentDir();
 	path += animationName + ".chroma";
 	const char* pathArg = TCHAR_TO_ANSI(*path);
-	int rzkey = _sKeyboardEnumMap[key];
+	int rzkey = KeyMap::GetKeyboardRzKey(key);
 	if (rzkey != ChromaSDK::Keyboard::RZKEY::RZKEY_INVALID)
 	{
 		int color = FChromaSDKPluginModule::Get().GetKeyColorName(pathArg, frameIndex, rzkey);
@@ -1,18 +1,25 @@
 #//include "ChromaSDKPlugin.h" //(support 4.15 or below)___HACK_UE4_WANTS_MODULE_FIRST
 #include "ChromaThread.h"
 #include "ChromaSDKPlugin.h" //(support 4.16 or above)___HACK_UE4_WANTS_HEADER_FIRST
-#include <chrono>
+#include "ChromaColor.h"
 
 using namespace ChromaSDK;
 using namespace std;
-using namespace std::chrono;
 
 ChromaThread* ChromaThread::_sInstance = new ChromaThread();
 
-ChromaThread::ChromaThread()
+ChromaThread::ChromaThread() :
+	_mReclaimer(_mTickMutex)
 {
 	_mThread = nullptr;
 	_mWaitForExit = true;
+	_mTimeScale = 1.0f;
+	_mPaused = false;
+	_mHold = false;
+	for (int i = 0; i < CANVAS_COUNT; ++i)
+	{
+		_mCanvases[i] = new ChromaCanvas((EChromaSDKDeviceEnum)i);
+	}
 }
 
 ChromaThread* ChromaThread::Instance()
@@ -22,62 +29,422 @@ ChromaThread* ChromaThread::Instance()
 
 void ChromaThread::ChromaWorker()
 {
-	// get current time
-	high_resolution_clock::time_point timer = high_resolution_clock::now();
-	high_resolution_clock::time_point timerLast = high_resolution_clock::now();
+	_mClock.Reset();
 
 	_mWaitForExit = true;
 
 	while (_mWaitForExit)
 	{
-		// get current time
-		timer = high_resolution_clock::now();
+		// get time in seconds, a new clock restarts the timeline
+		float deltaTime = _mClock.Step();
+
+		{
+			// checked under the tick lock so a held worker never interleaves with offline ticks
+			lock_guard<mutex> tickGuard(_mTickMutex);
+			if (!_mHold)
+			{
+				Step(deltaTime);
+			}
+		}
+
+		//std::this_thread::sleep_for(std::chrono::seconds(1));
+		//fprintf(stdout, "ChromaThread: Sleeping...\r\n");
+
+		//std::this_thread::sleep_for(std::chrono::microseconds(1));
+
+		this_thread::yield();
+	}
+
+	_mThread = nullptr;
+}
+
+void ChromaThread::Tick(float deltaTime)
+{
+	lock_guard<mutex> tickGuard(_mTickMutex);
+	Step(deltaTime);
+}
+
+void ChromaThread::Step(float deltaTime)
+{
+	deltaTime = ScaleTime(deltaTime);
+
+	// output stage, present the latest committed canvases
+	for (int i = 0; i < CANVAS_COUNT; ++i)
+	{
+		_mCanvases[i]->Present();
+	}
 
-		// get time in seconds
-		duration<double, std::milli> time_span = timer - timerLast;
-		float deltaTime = (float)(time_span.count() / 1000.0f);
-		timerLast = timer;
+	std::lock_guard<std::mutex> guard(_mMutex);
 
-		std::lock_guard<std::mutex> guard(_mMutex);
+	// update animations
+	for (unsigned int i = 0; i < _mAnimations.size(); ++i)
+	{
+		AnimationBase* animation = _mAnimations[i];
+		if (animation != nullptr)
+		{
+			animation->Update(animation->ScaleTime(deltaTime));
+		}
+	}
 
-		// update animations
-		vector<AnimationBase*> doneList = vector<AnimationBase*>();
-		for (unsigned int i = 0; i < _mAnimations.size(); ++i)
+	// asset objects play their effects here instead of in the game thread tick
+	unsigned int playerIndex = 0;
+	while (playerIndex < _mPlayers.size())
+	{
+		ChromaEffectPlayer* player = _mPlayers[playerIndex];
+		player->Update();
+		if (!player->IsPlaying())
 		{
-			AnimationBase* animation = _mAnimations[i];
-			if (animation != nullptr)
+			_mPlayers.erase(_mPlayers.begin() + playerIndex);
+			continue;
+		}
+		++playerIndex;
+	}
+
+	// sequences switch items inside the tick, completed sequences leave the list
+	unsigned int sequenceIndex = 0;
+	while (sequenceIndex < _mSequences.size())
+	{
+		AnimationSequence* sequence = _mSequences[sequenceIndex];
+		sequence->Update(deltaTime);
+		if (!sequence->IsPlaying())
+		{
+			_mSequences.erase(_mSequences.begin() + sequenceIndex);
+			continue;
+		}
+		++sequenceIndex;
+	}
+
+	// state machines pick their next state from the parameters the game wrote
+	AnimationStateMachine::FStateChange change;
+	for (unsigned int i = 0; i < _mStateMachines.size(); ++i)
+	{
+		if (_mStateMachines[i]->Evaluate(change))
+		{
+			ApplyStateChange(change);
+		}
+	}
+
+	// blend the frames the animations just reached, completed transitions finish their outgoing animation
+	UpdateTransitions(deltaTime);
+
+	// no need to update animations that are no longer playing
+	vector<AnimationBase*> doneList = vector<AnimationBase*>();
+	for (unsigned int i = 0; i < _mAnimations.size(); ++i)
+	{
+		AnimationBase* animation = _mAnimations[i];
+		if (animation != nullptr &&
+			!animation->IsPlaying())
+		{
+			doneList.push_back(animation);
+		}
+	}
+
+	for (int i = 0; i < doneList.size(); ++i)
+	{
+		AnimationBase* animation = doneList[i];
+		if (animation != nullptr)
+		{
+			auto it = find(_mAnimations.begin(), _mAnimations.end(), animation);
+			if (it != _mAnimations.end())
 			{
-				animation->Update(deltaTime);
-				// no need to update animations that are no longer playing
-				if (!animation->IsPlaying())
-				{
-					doneList.push_back(animation);
-				}
+				_mAnimations.erase(it);
 			}
 		}
+	}
+
+	UpdateInstances(deltaTime);
+
+	// the tick no longer holds any animation it read
+	_mReclaimer.AdvanceEpoch();
+}
 
-		for (int i = 0; i < doneList.size(); ++i)
+void ChromaThread::Retire(AnimationBase* animation)
+{
+	_mReclaimer.Retire(animation);
+}
+
+void ChromaThread::Reclaim(bool wait)
+{
+	_mReclaimer.Reclaim(wait);
+}
+
+void ChromaThread::PostEvent(AnimationBase* animation, EChromaSDKAnimationEventEnum type)
+{
+	FChromaAnimationEvent event;
+	event.AnimationId = animation->GetAnimationId();
+	event.Type = type;
+	if (event.AnimationId < 0)
+	{
+		return;
+	}
+	//a game thread that stopped draining drops events instead of stalling playback
+	_mEvents.Push(event);
+}
+
+bool ChromaThread::PopEvent(FChromaAnimationEvent& event)
+{
+	return _mEvents.Pop(event);
+}
+
+void ChromaThread::SetClock(CHROMA_THREAD_CLOCK clock)
+{
+	_mClock.SetClock(clock);
+}
+
+void ChromaThread::SetHold(bool hold)
+{
+	_mHold = hold;
+}
+
+void ChromaThread::UpdateInstances(float deltaTime)
+{
+#if PLATFORM_WINDOWS
+	bool changed[CANVAS_COUNT] = {};
+	for (unsigned int i = 0; i < _mInstances.size(); ++i)
+	{
+		AnimationInstance* instance = _mInstances[i];
+		if (instance->Update(deltaTime))
 		{
-			AnimationBase* animation = doneList[i];
-			if (animation != nullptr)
+			changed[(int)instance->GetDevice()] = true;
+		}
+	}
+	if (!FChromaSDKPluginModule::Get().IsInitialized())
+	{
+		return;
+	}
+	for (int device = 0; device < CANVAS_COUNT; ++device)
+	{
+		if (!changed[device])
+		{
+			continue;
+		}
+		// instances draw in the order they were created, later instances on top
+		ChromaCanvas* canvas = _mCanvases[device];
+		COLORREF colors[ChromaCanvas::MAX_SIZE] = {};
+		for (unsigned int i = 0; i < _mInstances.size(); ++i)
+		{
+			AnimationInstance* instance = _mInstances[i];
+			if ((int)instance->GetDevice() == device)
 			{
-				auto it = find(_mAnimations.begin(), _mAnimations.end(), animation);
-				if (it != _mAnimations.end())
-				{
-					_mAnimations.erase(it);
-				}
+				instance->Render(colors, canvas->GetMaxRow(), canvas->GetMaxColumn());
 			}
 		}
+		if (ChromaCanvas::ShowColors((EChromaSDKDeviceEnum)device, colors) != 0)
+		{
+			fprintf(stderr, "UpdateInstances: Failed to set instance effect!\r\n");
+		}
+	}
+#endif
+}
 
-		//std::this_thread::sleep_for(std::chrono::seconds(1));
-		//fprintf(stdout, "ChromaThread: Sleeping...\r\n");
+void ChromaThread::UpdateTransitions(float deltaTime)
+{
+	const bool initialized = FChromaSDKPluginModule::Get().IsInitialized();
+	unsigned int i = 0;
+	while (i < _mTransitions.size())
+	{
+		FTransition& transition = _mTransitions[i];
+		transition.Time += deltaTime;
+		if (transition.Time >= transition.Duration ||
+			!transition.To->IsPlaying())
+		{
+			EndTransition(i);
+			continue;
+		}
+		if (initialized)
+		{
+			ShowTransition(transition);
+		}
+		++i;
+	}
+}
 
-		//std::this_thread::sleep_for(std::chrono::microseconds(1));
+#if PLATFORM_WINDOWS
+// copy the frame the animation is on, stopped animations and other grid sizes read as black
+static void ReadCurrentFrame(AnimationBase* animation, COLORREF* colors, int count)
+{
+	lock_guard<mutex> guard(animation->GetFrameMutex());
+	const int frameCount = animation->GetFrameCount();
+	if (!animation->IsPlaying() ||
+		frameCount == 0 ||
+		animation->GetColorCount() != count)
+	{
+		memset(colors, 0, count * sizeof(COLORREF));
+		return;
+	}
+	int index = animation->GetCurrentFrame();
+	if (index < 0 ||
+		index >= frameCount)
+	{
+		index = 0;
+	}
+	//packed frames return their own storage which edits may replace once the lock is released
+	const COLORREF* frame = animation->GetFrameColors(index, colors);
+	if (frame != colors)
+	{
+		memcpy(colors, frame, count * sizeof(COLORREF));
+	}
+}
 
-		this_thread::yield();
+// fixed order in [0, 1) per color index so a dissolve reveals the same keys on every device and run
+static float GetDissolveThreshold(int index)
+{
+	return (((unsigned int)index * 2654435761u) >> 16 & 0xFFFF) / 65536.0f;
+}
+#endif
+
+void ChromaThread::ShowTransition(const FTransition& transition)
+{
+#if PLATFORM_WINDOWS
+	ChromaCanvas* canvas = _mCanvases[(int)transition.Device];
+	const int maxRow = canvas->GetMaxRow();
+	const int maxColumn = canvas->GetMaxColumn();
+	const int count = maxRow * maxColumn;
+	COLORREF from[ChromaCanvas::MAX_SIZE];
+	COLORREF to[ChromaCanvas::MAX_SIZE];
+	COLORREF colors[ChromaCanvas::MAX_SIZE];
+	ReadCurrentFrame(transition.From, from, count);
+	ReadCurrentFrame(transition.To, to, count);
+
+	const float amount = transition.Time / transition.Duration;
+	switch (transition.Type)
+	{
+	case EChromaSDKTransitionEnum::TE_Crossfade:
+		Color::Blend(from, to, colors, count, amount);
+		break;
+	case EChromaSDKTransitionEnum::TE_Wipe:
+		{
+			// left to right, single row devices wipe along their leds
+			const int edge = (int)(amount * maxColumn);
+			for (int i = 0; i < count; ++i)
+			{
+				colors[i] = (i % maxColumn) < edge ? to[i] : from[i];
+			}
+		}
+		break;
+	case EChromaSDKTransitionEnum::TE_Dissolve:
+		for (int i = 0; i < count; ++i)
+		{
+			colors[i] = GetDissolveThreshold(i) < amount ? to[i] : from[i];
+		}
+		break;
 	}
 
-	_mThread = nullptr;
+	if (ChromaCanvas::ShowColors(transition.Device, colors) != 0)
+	{
+		fprintf(stderr, "ShowTransition: Failed to set transition effect!\r\n");
+	}
+#endif
+}
+
+void ChromaThread::EndTransition(unsigned int index)
+{
+	FTransition transition = _mTransitions[index];
+	_mTransitions.erase(_mTransitions.begin() + index);
+	transition.From->Finish();
+	transition.From->SetMuted(false);
+	transition.To->SetMuted(false);
+	if (transition.To->IsPlaying())
+	{
+		transition.To->RefreshDevice();
+	}
+}
+
+void ChromaThread::AddTransition(AnimationBase* from, AnimationBase* to, EChromaSDKDeviceEnum device, EChromaSDKTransitionEnum type, float duration)
+{
+	lock_guard<mutex> guard(_mMutex);
+	BeginTransition(from, to, device, type, duration);
+}
+
+void ChromaThread::BeginTransition(AnimationBase* from, AnimationBase* to, EChromaSDKDeviceEnum device, EChromaSDKTransitionEnum type, float duration)
+{
+	if (to->IsClosed())
+	{
+		return;
+	}
+	if (from->IsClosed())
+	{
+		// nothing left to blend from, cut to the incoming animation
+		if (find(_mAnimations.begin(), _mAnimations.end(), to) == _mAnimations.end())
+		{
+			_mAnimations.push_back(to);
+		}
+		return;
+	}
+
+	// a transition already on the device completes right away
+	unsigned int i = 0;
+	while (i < _mTransitions.size())
+	{
+		const FTransition& transition = _mTransitions[i];
+		if (transition.Device == device ||
+			transition.From == to ||
+			transition.To == to)
+		{
+			EndTransition(i);
+			continue;
+		}
+		++i;
+	}
+
+	FTransition transition;
+	transition.From = from;
+	transition.To = to;
+	transition.Device = device;
+	transition.Type = type;
+	transition.Duration = duration;
+	transition.Time = 0.0f;
+	from->SetMuted(true);
+	to->SetMuted(true);
+	_mTransitions.push_back(transition);
+
+	if (find(_mAnimations.begin(), _mAnimations.end(), to) == _mAnimations.end())
+	{
+		_mAnimations.push_back(to);
+	}
+}
+
+void ChromaThread::ApplyStateChange(const AnimationStateMachine::FStateChange& change)
+{
+	for (unsigned int i = 0; i < change.Devices.size(); ++i)
+	{
+		AnimationBase* from = change.From[i];
+		AnimationBase* to = change.To[i];
+		if (to != nullptr &&
+			to->IsClosed())
+		{
+			// closed while the state was still pointing at it
+			to = nullptr;
+		}
+		if (from == to)
+		{
+			// shared by both states, keeps playing
+			continue;
+		}
+		if (to == nullptr)
+		{
+			from->Finish();
+			continue;
+		}
+		to->Start(change.Loop);
+		if (from != nullptr &&
+			from->IsPlaying() &&
+			change.BlendTime > 0.0f)
+		{
+			BeginTransition(from, to, change.Devices[i], change.Type, change.BlendTime);
+			continue;
+		}
+		if (from != nullptr)
+		{
+			from->Finish();
+		}
+		// a hard cut shows the first frame on this tick
+		to->Update(0.0f);
+		if (find(_mAnimations.begin(), _mAnimations.end(), to) == _mAnimations.end())
+		{
+			_mAnimations.push_back(to);
+		}
+	}
 }
 
 void ChromaThread::Start()
@@ -95,12 +462,26 @@ void ChromaThread::Stop()
 	_mWaitForExit = false;
 
 	std::lock_guard<std::mutex> guard(_mMutex);
+	for (unsigned int i = 0; i < _mTransitions.size(); ++i)
+	{
+		_mTransitions[i].From->SetMuted(false);
+		_mTransitions[i].To->SetMuted(false);
+	}
+	_mTransitions.clear();
 	_mAnimations.clear();
+	_mSequences.clear();
+	_mStateMachines.clear();
+	_mPlayers.clear();
+	_mInstances.clear();
 }
 
 void ChromaThread::AddAnimation(AnimationBase* animation)
 {
 	std::lock_guard<std::mutex> guard(_mMutex);
+	if (animation->IsClosed())
+	{
+		return;
+	}
 	// Add animation if it's not found
 	if (std::find(_mAnimations.begin(), _mAnimations.end(), animation) == _mAnimations.end())
 	{
@@ -109,6 +490,20 @@ void ChromaThread::AddAnimation(AnimationBase* animation)
 	
 }
 
+void ChromaThread::AddAnimations(const vector<AnimationBase*>& animations)
+{
+	lock_guard<mutex> guard(_mMutex);
+	for (unsigned int i = 0; i < animations.size(); ++i)
+	{
+		AnimationBase* animation = animations[i];
+		if (!animation->IsClosed() &&
+			find(_mAnimations.begin(), _mAnimations.end(), animation) == _mAnimations.end())
+		{
+			_mAnimations.push_back(animation);
+		}
+	}
+}
+
 void ChromaThread::RemoveAnimation(AnimationBase* animation)
 {
 	std::lock_guard<std::mutex> guard(_mMutex);
@@ -119,6 +514,30 @@ void ChromaThread::RemoveAnimation(AnimationBase* animation)
 		{
 			_mAnimations.erase(it);
 		}
+		unsigned int i = 0;
+		while (i < _mTransitions.size())
+		{
+			FTransition& transition = _mTransitions[i];
+			if (transition.From == animation)
+			{
+				// the incoming animation takes over early
+				transition.From->SetMuted(false);
+				transition.To->SetMuted(false);
+				transition.To->RefreshDevice();
+				_mTransitions.erase(_mTransitions.begin() + i);
+				continue;
+			}
+			if (transition.To == animation)
+			{
+				// nothing to hand over to, the outgoing animation stops with it
+				transition.From->Finish();
+				transition.From->SetMuted(false);
+				transition.To->SetMuted(false);
+				_mTransitions.erase(_mTransitions.begin() + i);
+				continue;
+			}
+			++i;
+		}
 	}
 }
 
@@ -140,8 +559,124 @@ int ChromaThread::GetAnimationId(int index)
 		AnimationBase* animation = _mAnimations[index];
 		if (animation != nullptr)
 		{
-			return FChromaSDKPluginModule::Get().GetAnimationIdFromInstance(animation);
+			return animation->GetAnimationId();
 		}
 	}
 	return -1;
 }
+
+void ChromaThread::AddSequence(AnimationSequence* sequence)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (find(_mSequences.begin(), _mSequences.end(), sequence) == _mSequences.end())
+	{
+		_mSequences.push_back(sequence);
+	}
+}
+
+void ChromaThread::RemoveSequence(AnimationSequence* sequence)
+{
+	lock_guard<mutex> guard(_mMutex);
+	auto it = find(_mSequences.begin(), _mSequences.end(), sequence);
+	if (it != _mSequences.end())
+	{
+		_mSequences.erase(it);
+	}
+}
+
+void ChromaThread::AddPlayer(ChromaEffectPlayer* player)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (find(_mPlayers.begin(), _mPlayers.end(), player) == _mPlayers.end())
+	{
+		_mPlayers.push_back(player);
+	}
+}
+
+void ChromaThread::RemovePlayer(ChromaEffectPlayer* player)
+{
+	lock_guard<mutex> guard(_mMutex);
+	auto it = find(_mPlayers.begin(), _mPlayers.end(), player);
+	if (it != _mPlayers.end())
+	{
+		_mPlayers.erase(it);
+	}
+}
+
+void ChromaThread::AddStateMachine(AnimationStateMachine* stateMachine)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (find(_mStateMachines.begin(), _mStateMachines.end(), stateMachine) == _mStateMachines.end())
+	{
+		_mStateMachines.push_back(stateMachine);
+	}
+}
+
+void ChromaThread::RemoveStateMachine(AnimationStateMachine* stateMachine)
+{
+	lock_guard<mutex> guard(_mMutex);
+	auto it = find(_mStateMachines.begin(), _mStateMachines.end(), stateMachine);
+	if (it != _mStateMachines.end())
+	{
+		_mStateMachines.erase(it);
+	}
+}
+
+void ChromaThread::AddInstance(AnimationInstance* instance)
+{
+	lock_guard<mutex> guard(_mMutex);
+	if (find(_mInstances.begin(), _mInstances.end(), instance) == _mInstances.end())
+	{
+		_mInstances.push_back(instance);
+	}
+}
+
+void ChromaThread::RemoveInstance(AnimationInstance* instance)
+{
+	lock_guard<mutex> guard(_mMutex);
+	auto it = find(_mInstances.begin(), _mInstances.end(), instance);
+	if (it != _mInstances.end())
+	{
+		_mInstances.erase(it);
+	}
+}
+
+void ChromaThread::SetTimeScale(float timeScale)
+{
+	_mTimeScale = timeScale < 0.0f ? 0.0f : timeScale;
+}
+
+float ChromaThread::GetTimeScale()
+{
+	return _mTimeScale;
+}
+
+void ChromaThread::SetPaused(bool paused)
+{
+	_mPaused = paused;
+}
+
+bool ChromaThread::IsPaused()
+{
+	return _mPaused;
+}
+
+float ChromaThread::ScaleTime(float deltaTime)
+{
+	if (_mPaused)
+	{
+		return 0.0f;
+	}
+	return deltaTime * _mTimeScale;
+}
+
+ChromaCanvas* ChromaThread::GetCanvas(EChromaSDKDeviceEnum device)
+{
+	int index = (int)device;
+	if (index < 0 ||
+		index >= CANVAS_COUNT)
+	{
+		return nullptr;
+	}
+	return _mCanvases[index];
+}
@@ -2,6 +2,8 @@
 
 #include "ChromaSDKPluginTypes.h"
 #include "AnimationBase.h"
+#include "ChromaFrame.h"
+#include <memory>
 
 #if PLATFORM_WINDOWS
 
@@ -11,24 +13,57 @@ namespace ChromaSDK
 	{
 	public:
 		Animation1D();
+		// releases the effects, the reclaimer deletes the animation once no tick can reach it
+		~Animation1D();
 		void Reset();
 		EChromaSDKDeviceTypeEnum GetDeviceType();
 		EChromaSDKDevice1DEnum GetDevice();
 		bool SetDevice(EChromaSDKDevice1DEnum device);
 		int GetDeviceId();
-		std::vector<FChromaSDKColorFrame1D>& GetFrames();
+		// packed frames for editing, palette frames are decoded first so call with the frame mutex held
+		std::vector<FChromaFrame1D>& GetFrames();
+		// number of packed colors in a frame for the device
+		int GetColorCount();
+		// read a frame without changing the encoding, returns the frame colors or the decoded scratch
+		const COLORREF* GetFrameColors(int index, COLORREF* scratch);
+		// palette encoding, frames keep one byte per LED and decode when effects are created
+		bool IsIndexed();
+		bool IndexFrames();
+		void SetIndexedFrames(std::vector<COLORREF>& palette, std::vector<FChromaIndexedFrame1D>& indexedFrames);
+		// recolor every frame, only the palette changes when indexed
+		void ReplaceColor(COLORREF color, COLORREF newColor);
+		// share the frames of another animation, copied on the first write to either
+		void ShareFrames(Animation1D* source);
 		int GetFrameCount();
 		float GetDuration(unsigned int index);
 		void Load();
 		void Unload();
 		void Play(bool loop);
+		void Start(bool loop);
 		void Stop();
 		void Update(float deltaTime);
 		void ResetFrames();
 		int Save(const char* path);
+		int Write(FILE* stream);
+		// batch edits over the frame range [startFrame, endFrame)
+		void FillFrames(int startFrame, int endFrame, COLORREF color);
+		void CopyRegion(Animation1D* source, int startFrame, int endFrame, int startLed, int leds);
+		void CopyNonZeroFrames(Animation1D* source, int startFrame, int endFrame);
+		void MultiplyFrames(int startFrame, int endFrame, float intensity);
+		void ShiftFrames(int startFrame, int endFrame, int offset);
+		void ReverseFrames(int startFrame, int endFrame);
+		void DuplicateFrames(int startFrame, int endFrame);
+		void TrimFrames(int startFrame, int endFrame);
+	protected:
+		FChromaSDKEffectResult CreateEffect(int index);
 	private:
+		// clone shared storage so this animation owns its frames
+		void DetachFrames();
+		// decode palette frames back to packed frames, call with the frame mutex held
+		void UnindexFrames();
 		EChromaSDKDevice1DEnum _mDevice;
-		std::vector<FChromaSDKColorFrame1D> _mFrames;
+		// shared with duplicates until the first write
+		std::shared_ptr<FChromaFrames1D> _mStorage;
 		bool _mLoop;
 	};
 }
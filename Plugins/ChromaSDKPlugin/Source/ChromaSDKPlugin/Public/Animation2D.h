@@ -2,6 +2,8 @@
 
 #include "ChromaSDKPluginTypes.h"
 #include "AnimationBase.h"
+#include "ChromaFrame.h"
+#include <memory>
 
 namespace ChromaSDK
 {
@@ -9,24 +11,62 @@ namespace ChromaSDK
 	{
 	public:
 		Animation2D();
+		// releases the effects, the reclaimer deletes the animation once no tick can reach it
+		~Animation2D();
 		void Reset();
 		EChromaSDKDeviceTypeEnum GetDeviceType();
 		EChromaSDKDevice2DEnum GetDevice();
 		bool SetDevice(EChromaSDKDevice2DEnum device);
 		int GetDeviceId();
-		std::vector<FChromaSDKColorFrame2D>& GetFrames();
+		// packed frames for editing, palette and run-length frames are decoded first so call with the frame mutex held
+		std::vector<FChromaFrame2D>& GetFrames();
+		// number of packed colors in a frame for the device
+		int GetColorCount();
+		// read a frame without changing the encoding, returns the frame colors or the decoded scratch
+		const COLORREF* GetFrameColors(int index, COLORREF* scratch);
+		// palette encoding, frames keep one byte per LED and decode when effects are created
+		bool IsIndexed();
+		bool IndexFrames();
+		void SetIndexedFrames(std::vector<COLORREF>& palette, std::vector<FChromaIndexedFrame2D>& indexedFrames);
+		// run-length encoding, each LED keeps a timeline of color changes
+		bool IsRunLength();
+		void EncodeRuns();
+		// switch to whichever of packed, palette or run-length frames takes the least memory
+		void CompactFrames();
+		// recolor every frame, only the palette or segments change when encoded
+		void ReplaceColor(COLORREF color, COLORREF newColor);
+		// share the frames of another animation, copied on the first write to either
+		void ShareFrames(Animation2D* source);
 		int GetFrameCount();
 		float GetDuration(unsigned int index);
 		void Load();
 		void Unload();
 		void Play(bool loop);
+		void Start(bool loop);
 		void Stop();
 		void Update(float deltaTime);
 		void ResetFrames();
 		int Save(const char* path);
+		int Write(FILE* stream);
+		// batch edits over the frame range [startFrame, endFrame)
+		void FillFrames(int startFrame, int endFrame, COLORREF color);
+		void CopyRegion(Animation2D* source, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns);
+		void CopyNonZeroFrames(Animation2D* source, int startFrame, int endFrame);
+		void MultiplyFrames(int startFrame, int endFrame, float intensity);
+		void ShiftFrames(int startFrame, int endFrame, int rowOffset, int columnOffset);
+		void ReverseFrames(int startFrame, int endFrame);
+		void DuplicateFrames(int startFrame, int endFrame);
+		void TrimFrames(int startFrame, int endFrame);
+	protected:
+		FChromaSDKEffectResult CreateEffect(int index);
 	private:
+		// clone shared storage so this animation owns its frames
+		void DetachFrames();
+		// decode palette or run-length frames back to packed frames, call with the frame mutex held
+		void DecodeFrames();
 		EChromaSDKDevice2DEnum _mDevice;
-		std::vector<FChromaSDKColorFrame2D> _mFrames;
+		// shared with duplicates until the first write
+		std::shared_ptr<FChromaFrames2D> _mStorage;
 		bool _mLoop;
 	};
 }
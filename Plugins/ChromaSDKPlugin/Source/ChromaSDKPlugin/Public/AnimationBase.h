@@ -2,6 +2,8 @@
 
 #include "ChromaSDKPlugin.h"
 #include "ChromaSDKPluginTypes.h"
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -11,6 +13,7 @@ namespace ChromaSDK
 	{
 	public:
 		AnimationBase();
+		virtual ~AnimationBase();
 		const std::string& GetName();
 		void SetName(const std::string& name);
 		virtual EChromaSDKDeviceTypeEnum GetDeviceType() = 0;
@@ -18,21 +21,107 @@ namespace ChromaSDK
 		virtual int GetDeviceId() = 0;
 		int GetCurrentFrame();
 		void SetCurrentFrame(int index);
+		// frame storage reads, call with the frame mutex held
 		virtual int GetFrameCount() = 0;
+		virtual float GetDuration(unsigned int index) = 0;
 		virtual void Play(bool loop) = 0;
+		// rewind and mark as playing without handing the animation to ChromaThread
+		virtual void Start(bool loop) = 0;
 		bool IsPlaying();
+		// time past the end of the last frame when the animation completed, lets a sequence start the next item on the frame boundary
+		float GetOvershoot();
+		// mark as done without touching ChromaThread, safe from inside its update
+		void Finish();
+		// a muted animation keeps playing but leaves the device to a transition
+		void SetMuted(bool muted);
+		bool IsMuted();
+		// set the effect of the current frame even if it is already on the device
+		void RefreshDevice();
+		// playback speed on top of the global time scale, lock free so it can change every frame
+		void SetTimeScale(float timeScale);
+		void SetPaused(bool paused);
+		// the time step this animation advances by, zero while paused
+		float ScaleTime(float deltaTime);
 		virtual void Load() = 0;
 		virtual void Unload() = 0;
 		virtual void Stop() = 0;
+		// holds the frame mutex while it reads the frames and effects
 		virtual void Update(float deltaTime) = 0;
 		virtual void ResetFrames() = 0;
 		virtual int Save(const char* path) = 0;
+		// write the animation file contents to an open stream, holds the frame mutex
+		virtual int Write(FILE* stream) = 0;
+		// edits hold the frame mutex while changing frames so playback can continue
+		std::mutex& GetFrameMutex();
+		// flag edited frames to have their effects recreated on the next update, call with the frame mutex held
+		void MarkFrameChanged(int index);
+		void MarkFramesChanged(int startFrame, int endFrame);
+		// bumped by every frame edit, lets derived data such as retargets tell when they are stale
+		unsigned int GetVersion();
+		// set once by the module when the animation is closed, nothing may start it afterwards
+		void Close();
+		bool IsClosed();
+		// the module id, set before the animation is registered, -1 before that and once closed
+		void SetAnimationId(int animationId);
+		int GetAnimationId();
+#if PLATFORM_WINDOWS
+		virtual int GetColorCount() = 0;
+		virtual const COLORREF* GetFrameColors(int index, COLORREF* scratch) = 0;
+#endif
+		// color indices that differ from the previous frame, frame 0 compares with the last frame for looping
+		int GetChangedCount(int index);
+		const uint8* GetChangedIndices(int index);
 	protected:
+		virtual FChromaSDKEffectResult CreateEffect(int index) = 0;
+		// match the effect list to the frames, only new and changed frames create effects, call with the frame mutex held
+		void SyncEffects();
+		// recreate the effects of changed frames and refresh the device if the current frame changed, call with the frame mutex held
+		void PublishChanges();
+		// refresh the changed index lists of the changed frames and the frames after them, all of them when the frame count changed,
+		// call before the changed frames are cleared with the frame mutex held
+		void UpdateFrameDiffs();
+		// set the effect for the current frame unless it matches the previous frame and nothing else was shown on the device since,
+		// call with the frame mutex held
+		void ShowCurrentFrame(bool force);
+		// set the effect and remember the device show count it left
+		int ShowEffect(const FChromaSDKEffectResult& effect);
+		// clamp [startFrame, endFrame) to the frame list, a negative endFrame selects through the last frame
+		bool ClampFrameRange(int& startFrame, int& endFrame);
+		// rewind after the frame list changes shape
+		void ResetPlayhead();
+		// report a loop or completion to the game thread, call from Update
+		void PostEvent(EChromaSDKAnimationEventEnum type);
 		std::string _mName;
 		int _mCurrentFrame;
 		bool _mIsLoaded;
 		bool _mIsPlaying;
+		bool _mMuted;
 		float _mTime;
+		float _mOvershoot;
 		std::vector<FChromaSDKEffectResult> _mEffects;
+		std::mutex _mFrameMutex;
+		std::vector<bool> _mChangedFrames;
+		bool _mHasChanges;
+		unsigned int _mVersion;
+		std::atomic<float> _mTimeScale;
+		std::atomic<bool> _mPaused;
+		std::atomic<bool> _mClosed;
+		std::atomic<int> _mAnimationId;
+		// the color indices that changed in each frame
+		std::vector<std::vector<uint8>> _mDiffIndices;
+		// the device show count after this animation last set an effect, another writer changes it
+		unsigned int _mShownCount;
+	};
+
+	// Holds the frame mutexes of a target and the source it copies from. std::lock
+	// takes both without a lock order deadlock, a copy within one animation or
+	// without a source locks the target once.
+	class AnimationPairLock
+	{
+	public:
+		AnimationPairLock(AnimationBase* target, AnimationBase* source);
+	private:
+		std::unique_lock<std::mutex> _mTargetGuard;
+		std::unique_lock<std::mutex> _mSourceGuard;
 	};
 }
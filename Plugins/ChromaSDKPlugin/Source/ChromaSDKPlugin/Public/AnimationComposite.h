@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include "AnimationBase.h"
+#include <string>
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// One animation per device on a shared timeline, loaded from a single
+	// composite file. The tracks are regular animations owned by the module,
+	// the composite starts and stops them together.
+	class AnimationComposite
+	{
+	public:
+		AnimationComposite();
+		const std::string& GetName();
+		void SetName(const std::string& name);
+		// at most one track per device
+		bool AddTrack(AnimationBase* track);
+		void RemoveTrack(AnimationBase* track);
+		const std::vector<AnimationBase*>& GetTracks();
+		AnimationBase* GetTrack(EChromaSDKDeviceEnum device);
+		// start every track and hand them to ChromaThread in one call so they share the first tick
+		void Play(bool loop);
+		void Stop();
+		bool IsPlaying();
+		// every track gets the same scale so the tracks stay in phase
+		void SetTimeScale(float timeScale);
+		void SetPaused(bool paused);
+		int Save(const char* path);
+	private:
+		std::string _mName;
+		std::vector<AnimationBase*> _mTracks;
+	};
+}
+
+#endif
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include "AnimationBase.h"
+#include <mutex>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// One playback of a loaded animation with its own playhead, speed, color
+	// intensity, grid offset and target device. Instances read the shared
+	// frames and are composited onto their device by the ChromaThread output
+	// stage, so frames are never copied and effects are never rebuilt.
+	class AnimationInstance
+	{
+	public:
+		AnimationInstance(AnimationBase* animation);
+		AnimationBase* GetAnimation();
+		EChromaSDKDeviceEnum GetDevice();
+		void SetDevice(EChromaSDKDeviceEnum device);
+		void SetSpeed(float speed);
+		void SetIntensity(float intensity);
+		void SetOffset(int rowOffset, int columnOffset);
+		void Play(bool loop);
+		void Stop();
+		bool IsPlaying();
+		// advance the playhead, returns true when the instance output changed
+		bool Update(float deltaTime);
+		// draw the current frame on top of a row major device grid, black is transparent
+		void Render(COLORREF* colors, int maxRow, int maxColumn);
+	private:
+		AnimationBase* _mAnimation;
+		std::mutex _mMutex;
+		EChromaSDKDeviceEnum _mDevice;
+		float _mSpeed;
+		float _mIntensity;
+		int _mRowOffset;
+		int _mColumnOffset;
+		bool _mIsPlaying;
+		bool _mLoop;
+		bool _mChanged;
+		int _mCurrentFrame;
+		float _mTime;
+	};
+}
+
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include "AnimationBase.h"
+#include <mutex>
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// A playlist of loaded animations, each played a number of times in a row.
+	// ChromaThread advances the sequence, an item that completes hands the rest
+	// of the tick to the next item so there is no gap between items, and the
+	// next item has its effects created while the current one plays.
+	class AnimationSequence
+	{
+	public:
+		AnimationSequence();
+		// play the animation loopCount times in a row, at least once, returns the item index
+		int AddItem(AnimationBase* animation, int loopCount);
+		// drop every item that plays the animation, call before the animation is deleted
+		void RemoveAnimation(AnimationBase* animation);
+		void Clear();
+		int GetItemCount();
+		std::vector<AnimationBase*> GetAnimations();
+		// start the first item and hand the sequence to ChromaThread, a looping sequence starts over after the last item
+		void Play(bool loop);
+		void Stop();
+		bool IsPlaying();
+		// advance the current item, ChromaThread calls this every tick
+		void Update(float deltaTime);
+	private:
+		struct FSequenceItem
+		{
+			AnimationBase* Animation;
+			int LoopCount;
+		};
+		// create the effects of the item after the current one, call with the mutex held
+		void PreloadNext();
+		std::mutex _mMutex;
+		std::vector<FSequenceItem> _mItems;
+		bool _mIsPlaying;
+		bool _mLoop;
+		int _mIndex;
+		int _mPass;
+	};
+}
+
+#endif
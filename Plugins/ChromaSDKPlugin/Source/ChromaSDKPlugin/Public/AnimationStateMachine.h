@@ -0,0 +1,81 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include "AnimationBase.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// A graph of lighting states, each playing up to one animation per device,
+	// with transitions taken when a parameter meets a condition. ChromaThread
+	// evaluates the graph every tick and blends the devices into the next
+	// state, the game only writes parameters, which never take a lock.
+	class AnimationStateMachine
+	{
+	public:
+		static const int MAX_PARAMETERS = 32;
+		// what ChromaThread has to do to enter a state, one entry per device,
+		// From or To is nullptr when only one of the states lights the device
+		struct FStateChange
+		{
+			std::vector<EChromaSDKDeviceEnum> Devices;
+			std::vector<AnimationBase*> From;
+			std::vector<AnimationBase*> To;
+			bool Loop;
+			float BlendTime;
+			EChromaSDKTransitionEnum Type;
+		};
+		AnimationStateMachine();
+		// returns the state index
+		int AddState(bool loop);
+		// at most one animation per device and state
+		bool AddStateAnimation(int state, AnimationBase* animation);
+		// a fromState of -1 leaves from any state, transitions are checked in the order they were added
+		int AddTransition(int fromState, int toState, int parameter, EChromaSDKCompareEnum compare, float value, float blendTime, EChromaSDKTransitionEnum type);
+		// drop the animation from every state, call before the animation is deleted
+		void RemoveAnimation(AnimationBase* animation);
+		// the animations of every state
+		std::vector<AnimationBase*> GetAnimations();
+		void SetParameter(int parameter, float value);
+		float GetParameter(int parameter);
+		int GetCurrentState();
+		// enter the state on the next tick and hand the graph to ChromaThread
+		void Play(int state);
+		void Stop();
+		bool IsPlaying();
+		// pick at most one state change for this tick, ChromaThread calls this with its lock held
+		bool Evaluate(FStateChange& change);
+	private:
+		struct FState
+		{
+			std::vector<AnimationBase*> Animations;
+			bool Loop;
+		};
+		struct FStateTransition
+		{
+			int From;
+			int To;
+			int Parameter;
+			EChromaSDKCompareEnum Compare;
+			float Value;
+			float BlendTime;
+			EChromaSDKTransitionEnum Type;
+		};
+		static EChromaSDKDeviceEnum GetDevice(AnimationBase* animation);
+		bool IsConditionMet(const FStateTransition& transition);
+		std::mutex _mMutex;
+		std::vector<FState> _mStates;
+		std::vector<FStateTransition> _mTransitions;
+		std::atomic<float> _mParameters[MAX_PARAMETERS];
+		std::atomic<int> _mCurrentState;
+		std::atomic<bool> _mIsPlaying;
+		bool _mEntered;
+	};
+}
+
+#endif
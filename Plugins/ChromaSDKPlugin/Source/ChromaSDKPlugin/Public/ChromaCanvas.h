@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include <atomic>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Live canvas of packed BGR colors for one device. The game thread draws
+	// into the back buffer and commits it, the ChromaThread output stage
+	// presents the newest committed buffer. A triple buffer hands the frames
+	// over, so neither side allocates or waits on the other.
+	class ChromaCanvas
+	{
+	public:
+		ChromaCanvas(EChromaSDKDeviceEnum device);
+		EChromaSDKDeviceEnum GetDevice();
+		EChromaSDKDeviceTypeEnum GetDeviceType();
+		int GetMaxRow();
+		int GetMaxColumn();
+		int GetSize();
+		// writer side, the back buffer is row major with GetMaxColumn() elements per row
+		COLORREF* GetBackBuffer();
+		void Commit();
+		// reader side, returns nullptr when nothing was committed since the last call
+		const COLORREF* AcquireFront();
+		void Present();
+		// apply packed colors to a device right away
+		static RZRESULT ShowColors(EChromaSDKDeviceEnum device, const COLORREF* colors);
+		static EChromaSDKDeviceEnum ToDevice(EChromaSDKDevice1DEnum device);
+		static EChromaSDKDeviceEnum ToDevice(EChromaSDKDevice2DEnum device);
+		// the keyboard grid is the largest device
+		static const int MAX_SIZE = Keyboard::MAX_ROW * Keyboard::MAX_COLUMN;
+	private:
+		static const int INDEX_MASK = 3;
+		static const int FRESH = 4;
+		EChromaSDKDeviceEnum _mDevice;
+		int _mMaxRow;
+		int _mMaxColumn;
+		COLORREF _mBuffers[3][MAX_SIZE];
+		int _mBack;
+		int _mFront;
+		std::atomic<int> _mMiddle;
+	};
+}
+
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+namespace ChromaSDK
+{
+	// What one device showed over a capture, as frames with durations. Steps
+	// that show the same colors extend the last frame instead of adding one.
+	// TColor is the packed color type. No engine includes so the standalone
+	// harness can build it.
+	template<typename TColor>
+	class ChromaCaptureTrack
+	{
+	public:
+		// append the colors shown for the duration, startTime is how long the capture ran before this step,
+		// a track that starts late opens with a black frame for that time
+		void Capture(const TColor* colors, int size, float duration, float startTime)
+		{
+			if (_mDurations.empty() &&
+				startTime > 0.0f)
+			{
+				_mDurations.push_back(startTime);
+				_mColors.resize(size, 0);
+			}
+			if (!_mDurations.empty() &&
+				memcmp(_mColors.data() + _mColors.size() - size, colors, size * sizeof(TColor)) == 0)
+			{
+				_mDurations.back() += duration;
+			}
+			else
+			{
+				_mDurations.push_back(duration);
+				_mColors.insert(_mColors.end(), colors, colors + size);
+			}
+		}
+
+		bool IsEmpty() const
+		{
+			return _mDurations.empty();
+		}
+
+		unsigned int GetFrameCount() const
+		{
+			return (unsigned int)_mDurations.size();
+		}
+
+		float GetDuration(unsigned int index) const
+		{
+			return _mDurations[index];
+		}
+
+		// size colors, the size passed to Capture
+		const TColor* GetColors(unsigned int index, int size) const
+		{
+			return _mColors.data() + index * size;
+		}
+
+	private:
+		std::vector<float> _mDurations;
+		// one frame of the device size per duration
+		std::vector<TColor> _mColors;
+	};
+}
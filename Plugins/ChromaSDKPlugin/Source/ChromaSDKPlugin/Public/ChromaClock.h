@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace ChromaSDK
+{
+	// seconds on any monotonic timeline, replaces the real time clock of the worker
+	typedef double(*CHROMA_THREAD_CLOCK)(void);
+
+	// Turns a clock into the time step of each tick. The clock can be swapped
+	// from another thread, a new clock restarts the timeline with a zero step.
+	// No engine includes so the standalone harness can build it.
+	class ChromaStepClock
+	{
+	public:
+		ChromaStepClock() :
+			_mClock(nullptr),
+			_mCurrent(nullptr),
+			_mLast(0.0)
+		{
+		}
+
+		// nullptr restores the real time clock
+		void SetClock(CHROMA_THREAD_CLOCK clock)
+		{
+			_mClock = clock;
+		}
+
+		// start the timeline at the current time, ticking thread only
+		void Reset()
+		{
+			_mCurrent = _mClock;
+			_mLast = Now(_mCurrent);
+		}
+
+		// seconds since the previous step, ticking thread only
+		float Step()
+		{
+			CHROMA_THREAD_CLOCK clock = _mClock;
+			double now = Now(clock);
+			if (clock != _mCurrent)
+			{
+				_mCurrent = clock;
+				_mLast = now;
+			}
+			float deltaTime = (float)(now - _mLast);
+			_mLast = now;
+			return deltaTime;
+		}
+
+	private:
+		static double Now(CHROMA_THREAD_CLOCK clock)
+		{
+			if (clock != nullptr)
+			{
+				return clock();
+			}
+			return std::chrono::duration<double>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+		}
+
+		std::atomic<CHROMA_THREAD_CLOCK> _mClock;
+		// ticking thread side, the clock the timeline runs on and its last reading
+		CHROMA_THREAD_CLOCK _mCurrent;
+		double _mLast;
+	};
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Batch conversion between FLinearColor and packed BGR. Channels are
+	// clamped to 0-1 and rounded to nearest, alpha is dropped going to BGR
+	// and set to 1 coming back. Uses AVX2 when the CPU supports it, SSE2
+	// otherwise.
+	namespace Color
+	{
+		CHROMASDKPLUGIN_API int ToBGR(const FLinearColor& color);
+		CHROMASDKPLUGIN_API FLinearColor ToLinearColor(int color);
+
+		CHROMASDKPLUGIN_API void ToBGR(const FLinearColor* colors, COLORREF* result, int count);
+		CHROMASDKPLUGIN_API void ToLinearColor(const COLORREF* colors, FLinearColor* result, int count);
+
+		// packed color math, saturating and integer only
+		CHROMASDKPLUGIN_API void Multiply(COLORREF* colors, int count, float intensity);
+		CHROMASDKPLUGIN_API void CopyNonZero(const COLORREF* source, COLORREF* target, int count);
+		// mix from toward to, 0 keeps from and 1 gives to
+		CHROMASDKPLUGIN_API void Blend(const COLORREF* from, const COLORREF* to, COLORREF* result, int count, float amount);
+
+		// one select mask cell per bit, all ones where the bit is set
+		CHROMASDKPLUGIN_API void ExpandMask(const uint32* bits, COLORREF* mask, int count);
+		// masked writes, cells where the select mask is zero keep their color
+		CHROMASDKPLUGIN_API void FillMasked(COLORREF* colors, const COLORREF* mask, int count, COLORREF color);
+		CHROMASDKPLUGIN_API void CopyMasked(const COLORREF* source, COLORREF* target, const COLORREF* mask, int count);
+		CHROMASDKPLUGIN_API void CopyNonZeroMasked(const COLORREF* source, COLORREF* target, const COLORREF* mask, int count);
+	}
+}
+
+#endif
@@ -0,0 +1,231 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Drawing primitives for device grids. The shapes are written once
+	// against a grid view and reduce to horizontal spans, which run through
+	// SIMD span kernels. 1D strips are grids with a single row.
+	namespace Draw
+	{
+		// the keyboard grid is the largest device, it bounds the flood fill stack
+		const int MAX_CELLS = Keyboard::MAX_ROW * Keyboard::MAX_COLUMN;
+
+		// span kernels
+		void FillSpan(COLORREF* colors, int count, COLORREF color);
+		void FillSpan(FLinearColor* colors, int count, const FLinearColor& color);
+		void GradientSpan(COLORREF* colors, int count, COLORREF startColor, COLORREF endColor);
+		void GradientSpan(FLinearColor* colors, int count, const FLinearColor& startColor, const FLinearColor& endColor);
+
+		// packed row major grid, such as a ChromaCanvas back buffer
+		struct FPackedGrid
+		{
+			typedef COLORREF ColorType;
+			COLORREF* Colors;
+			int MaxRow;
+			int MaxColumn;
+			COLORREF* GetRow(int row) const { return Colors + row * MaxColumn; }
+		};
+
+		// blueprint color grid, as made by CreateColors2D
+		struct FLinearGrid
+		{
+			typedef FLinearColor ColorType;
+			TArray<FChromaSDKColors>* Colors;
+			int MaxRow;
+			int MaxColumn;
+			FLinearColor* GetRow(int row) const { return (*Colors)[row].Colors.GetData(); }
+		};
+
+		// blueprint color strip, as made by CreateColors1D
+		struct FLinearStrip
+		{
+			typedef FLinearColor ColorType;
+			TArray<FLinearColor>* Colors;
+			int MaxRow;
+			int MaxColumn;
+			FLinearColor* GetRow(int /*row*/) const { return Colors->GetData(); }
+		};
+
+		FPackedGrid MakeGrid(COLORREF* colors, int maxRow, int maxColumn);
+		FLinearGrid MakeGrid(TArray<FChromaSDKColors>& colors);
+		FLinearStrip MakeStrip(TArray<FLinearColor>& colors);
+
+		template<typename TGrid>
+		void Rect(const TGrid& grid, int row, int column, int rows, int columns, const typename TGrid::ColorType& color)
+		{
+			int endRow = FMath::Min(row + rows, grid.MaxRow);
+			int endColumn = FMath::Min(column + columns, grid.MaxColumn);
+			row = FMath::Max(row, 0);
+			column = FMath::Max(column, 0);
+			if (column >= endColumn)
+			{
+				return;
+			}
+			for (int i = row; i < endRow; ++i)
+			{
+				FillSpan(grid.GetRow(i) + column, endColumn - column, color);
+			}
+		}
+
+		// fill the leftmost part of the rows, amount is 0 to 1
+		template<typename TGrid>
+		void HorizontalBar(const TGrid& grid, int row, int rows, float amount, const typename TGrid::ColorType& color)
+		{
+			int columns = FMath::RoundToInt(FMath::Clamp(amount, 0.0f, 1.0f) * grid.MaxColumn);
+			Rect(grid, row, 0, rows, columns, color);
+		}
+
+		// fill the bottom part of the columns, amount is 0 to 1
+		template<typename TGrid>
+		void VerticalBar(const TGrid& grid, int column, int columns, float amount, const typename TGrid::ColorType& color)
+		{
+			int rows = FMath::RoundToInt(FMath::Clamp(amount, 0.0f, 1.0f) * grid.MaxRow);
+			Rect(grid, grid.MaxRow - rows, column, rows, columns, color);
+		}
+
+		template<typename TGrid>
+		void Line(const TGrid& grid, int startRow, int startColumn, int endRow, int endColumn, const typename TGrid::ColorType& color)
+		{
+			int deltaColumn = FMath::Abs(endColumn - startColumn);
+			int deltaRow = -FMath::Abs(endRow - startRow);
+			int stepColumn = startColumn < endColumn ? 1 : -1;
+			int stepRow = startRow < endRow ? 1 : -1;
+			int error = deltaColumn + deltaRow;
+			while (true)
+			{
+				if (startRow >= 0 &&
+					startRow < grid.MaxRow &&
+					startColumn >= 0 &&
+					startColumn < grid.MaxColumn)
+				{
+					grid.GetRow(startRow)[startColumn] = color;
+				}
+				if (startRow == endRow &&
+					startColumn == endColumn)
+				{
+					break;
+				}
+				int error2 = 2 * error;
+				if (error2 >= deltaRow)
+				{
+					error += deltaRow;
+					startColumn += stepColumn;
+				}
+				if (error2 <= deltaColumn)
+				{
+					error += deltaColumn;
+					startRow += stepRow;
+				}
+			}
+		}
+
+		// filled circle, one span per row
+		template<typename TGrid>
+		void Circle(const TGrid& grid, float centerRow, float centerColumn, float radius, const typename TGrid::ColorType& color)
+		{
+			if (radius <= 0.0f)
+			{
+				return;
+			}
+			int startRow = FMath::Max(FMath::CeilToInt(centerRow - radius), 0);
+			int endRow = FMath::Min(FMath::FloorToInt(centerRow + radius), grid.MaxRow - 1);
+			for (int i = startRow; i <= endRow; ++i)
+			{
+				float offset = i - centerRow;
+				float halfWidth = FMath::Sqrt(FMath::Max(radius * radius - offset * offset, 0.0f));
+				int startColumn = FMath::CeilToInt(centerColumn - halfWidth);
+				int endColumn = FMath::FloorToInt(centerColumn + halfWidth);
+				Rect(grid, i, startColumn, 1, endColumn - startColumn + 1, color);
+			}
+		}
+
+		// left to right gradient inside the rectangle
+		template<typename TGrid>
+		void Gradient(const TGrid& grid, int row, int column, int rows, int columns, const typename TGrid::ColorType& startColor, const typename TGrid::ColorType& endColor)
+		{
+			int endRow = FMath::Min(row + rows, grid.MaxRow);
+			row = FMath::Max(row, 0);
+			if (columns <= 0)
+			{
+				return;
+			}
+			for (int i = row; i < endRow; ++i)
+			{
+				typename TGrid::ColorType* colors = grid.GetRow(i);
+				if (column >= 0 &&
+					column + columns <= grid.MaxColumn)
+				{
+					GradientSpan(colors + column, columns, startColor, endColor);
+				}
+				else
+				{
+					//clipped, draw the full gradient into a scratch span and copy the visible part
+					typename TGrid::ColorType span[MAX_CELLS];
+					int count = FMath::Min(columns, MAX_CELLS);
+					GradientSpan(span, count, startColor, endColor);
+					for (int j = FMath::Max(column, 0); j < column + count && j < grid.MaxColumn; ++j)
+					{
+						colors[j] = span[j - column];
+					}
+				}
+			}
+		}
+
+		// 4-way flood fill from the seed, the stack is bounded by the grid size so nothing is allocated
+		template<typename TGrid>
+		void FloodFill(const TGrid& grid, int row, int column, const typename TGrid::ColorType& color)
+		{
+			if (row < 0 ||
+				row >= grid.MaxRow ||
+				column < 0 ||
+				column >= grid.MaxColumn ||
+				grid.MaxRow * grid.MaxColumn > MAX_CELLS)
+			{
+				return;
+			}
+			const typename TGrid::ColorType target = grid.GetRow(row)[column];
+			if (target == color)
+			{
+				return;
+			}
+			int stack[MAX_CELLS * 4];
+			int count = 0;
+			stack[count++] = row * grid.MaxColumn + column;
+			while (count > 0)
+			{
+				int index = stack[--count];
+				int i = index / grid.MaxColumn;
+				int j = index % grid.MaxColumn;
+				typename TGrid::ColorType& cell = grid.GetRow(i)[j];
+				if (!(cell == target))
+				{
+					continue;
+				}
+				cell = color;
+				if (i > 0 && grid.GetRow(i - 1)[j] == target)
+				{
+					stack[count++] = index - grid.MaxColumn;
+				}
+				if (i + 1 < grid.MaxRow && grid.GetRow(i + 1)[j] == target)
+				{
+					stack[count++] = index + grid.MaxColumn;
+				}
+				if (j > 0 && grid.GetRow(i)[j - 1] == target)
+				{
+					stack[count++] = index - 1;
+				}
+				if (j + 1 < grid.MaxColumn && grid.GetRow(i)[j + 1] == target)
+				{
+					stack[count++] = index + 1;
+				}
+			}
+		}
+	}
+}
+
+#endif
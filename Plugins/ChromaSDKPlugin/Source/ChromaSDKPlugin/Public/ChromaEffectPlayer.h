@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include <atomic>
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Steps through effects that an asset object created, ChromaThread
+	// advances it so the device calls stay off the game thread. The owner
+	// forwards its game time through AdvanceTime, so game pause and time
+	// dilation hold playback, and gets completion back through TakeCompleted.
+	class ChromaEffectPlayer
+	{
+	public:
+		ChromaEffectPlayer();
+		// frame i shows until times[i], counted from the start of playback
+		void Play(const std::vector<RZEFFECTID>& effects, const std::vector<float>& times);
+		// after this returns the worker no longer touches the player
+		void Stop();
+		bool IsPlaying();
+		// true once for each playback that reached its end
+		bool TakeCompleted();
+		// add game time from the owner's tick, scaled by the playback time scale, only the owner's thread calls it
+		void AdvanceTime(float deltaTime);
+		// call from the tick with the ChromaThread mutex held
+		void Update();
+	private:
+		void ShowFrame(int index);
+		std::vector<RZEFFECTID> _mEffects;
+		std::vector<float> _mTimes;
+		// game time since play, written by the owner and read by the worker
+		std::atomic<float> _mTime;
+		int _mCurrentFrame;
+		int _mShownFrame;
+		std::atomic<bool> _mIsPlaying;
+		std::atomic<bool> _mCompleted;
+	};
+}
+
+#endif
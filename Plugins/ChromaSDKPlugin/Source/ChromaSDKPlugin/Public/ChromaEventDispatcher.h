@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginBPLibrary.h"
+#include <mutex>
+
+#if PLATFORM_WINDOWS
+
+// Drains the ChromaThread event queue once per game frame and runs the
+// delegates bound to each animation, so nothing has to poll for completion.
+// Closing an animation unbinds it from whichever thread closed it.
+class FChromaEventDispatcher : public FTickableGameObject
+{
+public:
+	void Bind(int animationId, const FString& animationName, const FDelegateChromaSDKAnimationEvent& onEvent);
+	void Unbind(int animationId);
+	void UnbindName(const FString& animationName);
+
+	/* Implements FTickableGameObject */
+	void Tick(float DeltaTime) override;
+	bool IsTickable() const override;
+	bool IsTickableInEditor() const override;
+	bool IsTickableWhenPaused() const override;
+	TStatId GetStatId() const override;
+	/* Implements FTickableGameObject */
+
+private:
+	struct FEventHandler
+	{
+		FString AnimationName;
+		FDelegateChromaSDKAnimationEvent OnEvent;
+	};
+	std::mutex _mHandlerMutex;
+	TMap<int, FEventHandler> _mHandlers;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include <atomic>
+
+namespace ChromaSDK
+{
+	struct FChromaAnimationEvent
+	{
+		int AnimationId;
+		EChromaSDKAnimationEventEnum Type;
+	};
+
+	// Single producer, single consumer ring buffer. ChromaThread pushes from
+	// its tick and the game thread pops, neither side waits on the other.
+	class ChromaEventQueue
+	{
+	public:
+		ChromaEventQueue();
+		// false when the queue is full and the event was dropped
+		bool Push(const FChromaAnimationEvent& event);
+		bool Pop(FChromaAnimationEvent& event);
+	private:
+		static const unsigned int CAPACITY = 256;
+		FChromaAnimationEvent _mEvents[CAPACITY];
+		// next slot to pop, only the consumer writes it
+		std::atomic<unsigned int> _mHead;
+		// next slot to push, only the producer writes it
+		std::atomic<unsigned int> _mTail;
+	};
+}
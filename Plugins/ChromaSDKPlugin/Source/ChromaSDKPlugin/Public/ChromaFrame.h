@@ -0,0 +1,273 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Runtime frames hold packed device BGR, the same 8 bits per channel the
+	// SDK takes, so playback and edits never touch float color. The float
+	// FChromaSDKColorFrame types only cross the blueprint boundary.
+
+	// the mousepad has the most LEDs of the 1D devices
+	const int MAX_COLORS_1D = Mousepad::MAX_LEDS;
+	// the keyboard has the most cells of the 2D devices
+	const int MAX_COLORS_2D = Keyboard::MAX_ROW * Keyboard::MAX_COLUMN;
+
+	struct FChromaFrame1D
+	{
+		float Duration;
+		COLORREF Colors[MAX_COLORS_1D];
+
+		FChromaFrame1D()
+		{
+			Duration = 1;
+			memset(Colors, 0, sizeof(Colors));
+		}
+	};
+
+	// row major, rows are GetMaxColumn(device) wide
+	struct FChromaFrame2D
+	{
+		float Duration;
+		COLORREF Colors[MAX_COLORS_2D];
+
+		FChromaFrame2D()
+		{
+			Duration = 1;
+			memset(Colors, 0, sizeof(Colors));
+		}
+	};
+
+	// Palette encoded frames store one byte per LED that indexes a palette
+	// shared by the whole animation, a quarter of the packed size.
+	const int MAX_PALETTE_SIZE = 256;
+
+	struct FChromaIndexedFrame1D
+	{
+		float Duration;
+		uint8 Indices[MAX_COLORS_1D];
+	};
+
+	struct FChromaIndexedFrame2D
+	{
+		float Duration;
+		uint8 Indices[MAX_COLORS_2D];
+	};
+
+	namespace Palette
+	{
+		// index the frames against a new palette, false when they use more than MAX_PALETTE_SIZE colors
+		template<typename TFrame, typename TIndexedFrame>
+		bool Encode(const std::vector<TFrame>& frames, int count, std::vector<COLORREF>& palette, std::vector<TIndexedFrame>& indexedFrames)
+		{
+			std::vector<COLORREF> colors;
+			std::vector<TIndexedFrame> indexed(frames.size());
+			std::map<COLORREF, uint8> lookup;
+			for (unsigned int index = 0; index < frames.size(); ++index)
+			{
+				const TFrame& frame = frames[index];
+				TIndexedFrame& indexedFrame = indexed[index];
+				indexedFrame.Duration = frame.Duration;
+				memset(indexedFrame.Indices, 0, sizeof(indexedFrame.Indices));
+				for (int i = 0; i < count; ++i)
+				{
+					auto it = lookup.find(frame.Colors[i]);
+					if (it == lookup.end())
+					{
+						if (colors.size() == MAX_PALETTE_SIZE)
+						{
+							return false;
+						}
+						it = lookup.insert(std::make_pair(frame.Colors[i], (uint8)colors.size())).first;
+						colors.push_back(frame.Colors[i]);
+					}
+					indexedFrame.Indices[i] = it->second;
+				}
+			}
+			palette.swap(colors);
+			indexedFrames.swap(indexed);
+			return true;
+		}
+
+		template<typename TIndexedFrame>
+		void Decode(const std::vector<COLORREF>& palette, const TIndexedFrame& indexedFrame, COLORREF* colors, int count)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				colors[i] = palette[indexedFrame.Indices[i]];
+			}
+		}
+
+		// every index has to land inside the palette before the frame can be decoded
+		template<typename TIndexedFrame>
+		bool Validate(const std::vector<COLORREF>& palette, const TIndexedFrame& indexedFrame, int count)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				if (indexedFrame.Indices[i] >= palette.size())
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	// Run-length frames store each LED as a timeline of segments, a segment
+	// holds its color from StartFrame until the next segment starts. Memory
+	// follows the number of color changes instead of frames times LEDs.
+	struct FChromaRunSegment
+	{
+		int StartFrame;
+		COLORREF Color;
+	};
+
+	struct FChromaRunFrames
+	{
+		std::vector<float> Durations;
+		// LED i owns Segments[Offsets[i]] up to Segments[Offsets[i + 1]]
+		std::vector<int> Offsets;
+		std::vector<FChromaRunSegment> Segments;
+	};
+
+	namespace RunLength
+	{
+		template<typename TFrame>
+		int CountSegments(const std::vector<TFrame>& frames, int count)
+		{
+			if (frames.size() == 0)
+			{
+				return 0;
+			}
+			int segments = count;
+			for (unsigned int index = 1; index < frames.size(); ++index)
+			{
+				const COLORREF* previous = frames[index - 1].Colors;
+				const COLORREF* colors = frames[index].Colors;
+				for (int i = 0; i < count; ++i)
+				{
+					if (colors[i] != previous[i])
+					{
+						++segments;
+					}
+				}
+			}
+			return segments;
+		}
+
+		// bytes the run-length encoding takes for the frames
+		inline size_t GetSize(int frameCount, int count, int segments)
+		{
+			return frameCount * sizeof(float) + (count + 1) * sizeof(int) + segments * sizeof(FChromaRunSegment);
+		}
+
+		template<typename TFrame>
+		void Encode(const std::vector<TFrame>& frames, int count, FChromaRunFrames& runs)
+		{
+			runs.Durations.resize(frames.size());
+			for (unsigned int index = 0; index < frames.size(); ++index)
+			{
+				runs.Durations[index] = frames[index].Duration;
+			}
+			runs.Offsets.resize(count + 1);
+			runs.Segments.clear();
+			runs.Segments.reserve(CountSegments(frames, count));
+			for (int i = 0; i < count; ++i)
+			{
+				runs.Offsets[i] = runs.Segments.size();
+				for (unsigned int index = 0; index < frames.size(); ++index)
+				{
+					const COLORREF color = frames[index].Colors[i];
+					if (index == 0 ||
+						color != runs.Segments.back().Color)
+					{
+						FChromaRunSegment segment;
+						segment.StartFrame = index;
+						segment.Color = color;
+						runs.Segments.push_back(segment);
+					}
+				}
+			}
+			runs.Offsets[count] = runs.Segments.size();
+		}
+
+		// random access, binary search each LED timeline for the frame
+		inline void Decode(const FChromaRunFrames& runs, int index, COLORREF* colors, int count)
+		{
+			const FChromaRunSegment* segments = runs.Segments.data();
+			for (int i = 0; i < count; ++i)
+			{
+				const FChromaRunSegment* first = segments + runs.Offsets[i];
+				const FChromaRunSegment* last = segments + runs.Offsets[i + 1];
+				const FChromaRunSegment* it = std::upper_bound(first, last, index,
+					[](int frame, const FChromaRunSegment& segment) { return frame < segment.StartFrame; });
+				colors[i] = (it == first) ? 0 : (it - 1)->Color;
+			}
+		}
+
+		// sequential decode of every frame, each LED advances a cursor instead of searching
+		template<typename TFrame>
+		void DecodeAll(const FChromaRunFrames& runs, int count, std::vector<TFrame>& frames)
+		{
+			frames.resize(runs.Durations.size());
+			for (unsigned int index = 0; index < frames.size(); ++index)
+			{
+				frames[index].Duration = runs.Durations[index];
+			}
+			for (int i = 0; i < count; ++i)
+			{
+				int cursor = runs.Offsets[i];
+				const int last = runs.Offsets[i + 1];
+				for (unsigned int index = 0; index < frames.size(); ++index)
+				{
+					while (cursor + 1 < last &&
+						runs.Segments[cursor + 1].StartFrame <= (int)index)
+					{
+						++cursor;
+					}
+					frames[index].Colors[i] = (cursor < last) ? runs.Segments[cursor].Color : 0;
+				}
+			}
+		}
+	}
+
+	// Frame storage for an animation in whichever encoding it uses. Duplicated
+	// animations share one storage and clone it on their first write.
+	struct FChromaFrames1D
+	{
+		std::vector<FChromaFrame1D> Frames;
+		bool Indexed;
+		std::vector<COLORREF> Palette;
+		std::vector<FChromaIndexedFrame1D> IndexedFrames;
+
+		FChromaFrames1D()
+		{
+			Frames.push_back(FChromaFrame1D());
+			Indexed = false;
+		}
+	};
+
+	struct FChromaFrames2D
+	{
+		std::vector<FChromaFrame2D> Frames;
+		bool Indexed;
+		std::vector<COLORREF> Palette;
+		std::vector<FChromaIndexedFrame2D> IndexedFrames;
+		bool RunLength;
+		FChromaRunFrames Runs;
+
+		FChromaFrames2D()
+		{
+			Frames.push_back(FChromaFrame2D());
+			Indexed = false;
+			RunLength = false;
+		}
+	};
+}
+
+#endif
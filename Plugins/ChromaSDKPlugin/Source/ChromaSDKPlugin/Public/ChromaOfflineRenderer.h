@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaRecorder.h"
+#include "ChromaTimeline.h"
+#include <functional>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Runs the playback pipeline against a scripted timeline on a virtual
+	// clock, as fast as the CPU allows. While rendering the worker thread is
+	// held and the module talks to a recorder instead of the SDK, so the same
+	// timeline always produces the same frames. The timeline, clock and capture
+	// tracks are engine free, only this glue needs the plugin build.
+	class ChromaOfflineRenderer
+	{
+	public:
+		ChromaOfflineRenderer(float stepTime);
+		// the action runs on the game side of the step at or after the time, events at the same time keep their order
+		void AddEvent(float time, const std::function<void()>& action);
+		// step the pipeline from 0 to the duration and capture every device after each step
+		void Render(float duration);
+		// write basePath_Device.chroma for each device that showed colors
+		int Save(const char* basePath);
+	private:
+		ChromaTimeline _mTimeline;
+		ChromaRecorder _mRecorder;
+	};
+}
+
+#endif
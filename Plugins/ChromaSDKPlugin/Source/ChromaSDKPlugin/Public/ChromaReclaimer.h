@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace ChromaSDK
+{
+	// Deferred delete for objects a tick may still be reading. The tick runs
+	// under the tick mutex and advances the epoch when it completes, an object
+	// retired during a tick is deleted once that tick has left.
+	// No engine includes so the standalone harness can build it.
+	template<typename T>
+	class ChromaReclaimer
+	{
+	public:
+		explicit ChromaReclaimer(std::mutex& tickMutex) :
+			_mTickMutex(tickMutex),
+			_mEpoch(0)
+		{
+		}
+
+		~ChromaReclaimer()
+		{
+			Reclaim(true);
+		}
+
+		// the tick no longer holds any object it read, call at the end of the tick with the tick mutex held
+		void AdvanceEpoch()
+		{
+			++_mEpoch;
+		}
+
+		// the object must already be out of every list the tick reads
+		void Retire(T* object)
+		{
+			FRetired retired;
+			retired.Object = object;
+			retired.Epoch = _mEpoch;
+			std::lock_guard<std::mutex> guard(_mRetireMutex);
+			_mRetired.push_back(retired);
+		}
+
+		// delete the retired objects that are safe to delete, wait blocks for the tick in flight and deletes all of them
+		void Reclaim(bool wait)
+		{
+			std::vector<T*> reclaimed;
+			{
+				// with no tick in flight every retired object is unreachable
+				std::unique_lock<std::mutex> tickGuard(_mTickMutex, std::defer_lock);
+				bool idle = true;
+				if (wait)
+				{
+					tickGuard.lock();
+				}
+				else
+				{
+					idle = tickGuard.try_lock();
+				}
+				const unsigned int epoch = _mEpoch;
+				std::lock_guard<std::mutex> guard(_mRetireMutex);
+				unsigned int i = 0;
+				while (i < _mRetired.size())
+				{
+					// a tick that was in flight at retire time has completed once the epoch moved
+					if (idle ||
+						_mRetired[i].Epoch != epoch)
+					{
+						reclaimed.push_back(_mRetired[i].Object);
+						_mRetired.erase(_mRetired.begin() + i);
+						continue;
+					}
+					++i;
+				}
+			}
+			// outside the locks, destructors may retire or reclaim again
+			for (unsigned int i = 0; i < reclaimed.size(); ++i)
+			{
+				delete reclaimed[i];
+			}
+		}
+
+		unsigned int GetRetiredCount()
+		{
+			std::lock_guard<std::mutex> guard(_mRetireMutex);
+			return (unsigned int)_mRetired.size();
+		}
+
+	private:
+		struct FRetired
+		{
+			T* Object;
+			unsigned int Epoch;
+		};
+		std::mutex& _mTickMutex;
+		// bumped when a tick completes, a retired object is safe once the epoch moved past its retire epoch
+		std::atomic<unsigned int> _mEpoch;
+		std::mutex _mRetireMutex;
+		std::vector<FRetired> _mRetired;
+	};
+}
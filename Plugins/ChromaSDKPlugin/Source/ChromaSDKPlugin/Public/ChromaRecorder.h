@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+#include "ChromaCanvas.h"
+#include "ChromaCaptureTrack.h"
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Stands in for the Chroma SDK while attached to the module. Effects are
+	// kept as packed colors and every effect that is set becomes what its
+	// device shows, so the whole pipeline runs without hardware and the
+	// output can be captured step by step.
+	class ChromaRecorder
+	{
+	public:
+		ChromaRecorder();
+		RZRESULT CreateEffect(EChromaSDKDeviceEnum device, const COLORREF* colors, RZEFFECTID* pEffectId);
+		RZRESULT SetEffect(RZEFFECTID effectId);
+		RZRESULT DeleteEffect(RZEFFECTID effectId);
+		// append what each device shows for the duration, repeated output extends the last frame,
+		// a device that starts showing late gets a black frame for the time before
+		void Capture(float duration);
+		// write each device that showed colors to basePath_Device.chroma
+		int Save(const char* basePath);
+	private:
+		static const int DEVICE_COUNT = (int)EChromaSDKDeviceEnum::DE_Mousepad + 1;
+		struct FRecordedEffect
+		{
+			EChromaSDKDeviceEnum Device;
+			std::vector<COLORREF> Colors;
+		};
+		void Show(EChromaSDKDeviceEnum device, const COLORREF* colors);
+		static int GetSize(EChromaSDKDeviceEnum device);
+		std::mutex _mMutex;
+		unsigned long _mNextEffectId;
+		std::map<unsigned long, FRecordedEffect> _mEffects;
+		bool _mShown[DEVICE_COUNT];
+		COLORREF _mShowing[DEVICE_COUNT][ChromaCanvas::MAX_SIZE];
+		ChromaCaptureTrack<COLORREF> _mTracks[DEVICE_COUNT];
+		float _mCapturedTime;
+	};
+}
+
+#endif
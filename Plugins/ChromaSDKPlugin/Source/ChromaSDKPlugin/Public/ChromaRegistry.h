@@ -0,0 +1,125 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ChromaSDK
+{
+	// Id and name tables published as an immutable snapshot. Readers load the
+	// snapshot without a lock and every object they find stays alive while they
+	// hold it. When the last reference goes TRetire takes the object, so nothing
+	// is deleted while an API call or a stale snapshot can still reach it.
+	// T needs GetName(). No engine includes so the standalone harness can build it.
+	template<typename T, typename TRetire>
+	class ChromaRegistry
+	{
+	public:
+		struct FSnapshot
+		{
+			std::map<int, std::shared_ptr<T>> Objects;
+			std::map<std::string, int> Names;
+		};
+
+		ChromaRegistry() :
+			_mSnapshot(std::make_shared<FSnapshot>())
+		{
+		}
+
+		std::shared_ptr<const FSnapshot> GetSnapshot()
+		{
+			return std::atomic_load(&_mSnapshot);
+		}
+
+		// null when the id is not registered
+		std::shared_ptr<T> Find(int id)
+		{
+			std::shared_ptr<const FSnapshot> snapshot = GetSnapshot();
+			auto it = snapshot->Objects.find(id);
+			if (it != snapshot->Objects.end())
+			{
+				return it->second;
+			}
+			return std::shared_ptr<T>();
+		}
+
+		// -1 when the name is not registered
+		int FindName(const std::string& name)
+		{
+			std::shared_ptr<const FSnapshot> snapshot = GetSnapshot();
+			auto it = snapshot->Names.find(name);
+			if (it != snapshot->Names.end())
+			{
+				return it->second;
+			}
+			return -1;
+		}
+
+		// add under the id and publish, a null name keeps the object out of the name map,
+		// returns the existing id when another thread registered the name first and deletes the object
+		int Register(int id, T* object, const char* name)
+		{
+			std::lock_guard<std::mutex> guard(_mMutex);
+			if (name != nullptr)
+			{
+				auto it = _mNames.find(name);
+				if (it != _mNames.end())
+				{
+					//never published so it can go right away
+					delete object;
+					return it->second;
+				}
+				_mNames[name] = id;
+			}
+			_mObjects[id] = std::shared_ptr<T>(object, TRetire());
+			Publish();
+			return id;
+		}
+
+		// false when the id was not registered or another caller removed it first,
+		// only the caller that gets true may tear the object down
+		bool Unregister(int id)
+		{
+			std::lock_guard<std::mutex> guard(_mMutex);
+			auto it = _mObjects.find(id);
+			if (it == _mObjects.end())
+			{
+				return false;
+			}
+			auto name = _mNames.find(it->second->GetName());
+			if (name != _mNames.end() &&
+				name->second == id)
+			{
+				_mNames.erase(name);
+			}
+			_mObjects.erase(it);
+			Publish();
+			return true;
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> guard(_mMutex);
+			_mNames.clear();
+			_mObjects.clear();
+			Publish();
+		}
+
+	private:
+		// call with the mutex held
+		void Publish()
+		{
+			FSnapshot* snapshot = new FSnapshot();
+			snapshot->Objects = _mObjects;
+			snapshot->Names = _mNames;
+			std::atomic_store(&_mSnapshot, std::shared_ptr<const FSnapshot>(snapshot));
+		}
+
+		// writer side, changed under the mutex and published as a snapshot
+		std::mutex _mMutex;
+		std::map<int, std::shared_ptr<T>> _mObjects;
+		std::map<std::string, int> _mNames;
+		std::shared_ptr<const FSnapshot> _mSnapshot;
+	};
+}
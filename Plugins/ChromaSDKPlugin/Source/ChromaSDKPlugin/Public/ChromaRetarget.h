@@ -0,0 +1,26 @@
+#pragma once
+
+#include "ChromaSDKPlugin.h"
+#include "ChromaSDKPluginTypes.h"
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	class AnimationBase;
+
+	// Resample frames authored for one device to another device geometry.
+	// 1D strips are grids with a single row, so reducing a grid to a strip
+	// averages every row into each LED. Runs at load time, playback of the
+	// result costs the same as any other animation.
+	namespace Retarget
+	{
+		void GetGridSize(EChromaSDKDeviceEnum device, int& maxRow, int& maxColumn);
+		EChromaSDKDeviceEnum GetDevice(AnimationBase* animation);
+		// separable resample of a row major grid, area average keeps thin features when shrinking
+		void Resample(const COLORREF* source, int sourceRows, int sourceColumns,
+			COLORREF* target, int targetRows, int targetColumns, EChromaSDKRetargetKernel kernel);
+	}
+}
+
+#endif
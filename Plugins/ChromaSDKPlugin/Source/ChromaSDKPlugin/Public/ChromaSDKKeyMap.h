@@ -0,0 +1,216 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ChromaSDKPluginTypes.h"
+
+#if PLATFORM_WINDOWS
+
+namespace ChromaSDK
+{
+	// Flat lookup tables indexed by the blueprint enums. The row, column and
+	// linear grid index of every key are decoded at compile time so the bulk
+	// key methods never go through a tree lookup.
+	namespace KeyMap
+	{
+		struct FKeyLocation
+		{
+			int RzKey;
+			int Row;
+			int Column;
+			int Index;
+		};
+
+		constexpr FKeyLocation MakeKeyLocation(int rzkey, int maxColumn)
+		{
+			return rzkey == Keyboard::RZKEY::RZKEY_INVALID
+				? FKeyLocation{ rzkey, -1, -1, -1 }
+				: FKeyLocation{ rzkey, (rzkey >> 8) & 0xFF, rzkey & 0xFF, ((rzkey >> 8) & 0xFF) * maxColumn + (rzkey & 0xFF) };
+		}
+
+		// keyboard locations in EChromaSDKKeyboardKey order
+		constexpr FKeyLocation KEYBOARD_KEYS[] =
+		{
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_ESC, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F6, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F7, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F8, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F9, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F10, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F11, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F12, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_6, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_7, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_8, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_9, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_0, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_A, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_B, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_C, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_D, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_E, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_F, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_G, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_H, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_I, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_J, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_K, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_L, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_M, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_N, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_O, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_P, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_Q, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_R, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_S, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_T, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_U, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_V, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_W, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_X, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_Y, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_Z, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMLOCK, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD0, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD6, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD7, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD8, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD9, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD_DIVIDE, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD_MULTIPLY, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD_SUBTRACT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD_ADD, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD_ENTER, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_NUMPAD_DECIMAL, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_PRINTSCREEN, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_SCROLL, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_PAUSE, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_INSERT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_HOME, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_PAGEUP, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_DELETE, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_END, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_PAGEDOWN, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_UP, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_LEFT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_DOWN, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_RIGHT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_TAB, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_CAPSLOCK, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_BACKSPACE, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_ENTER, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_LCTRL, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_LWIN, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_LALT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_SPACE, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_RALT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_FN, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_RMENU, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_RCTRL, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_LSHIFT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_RSHIFT, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_MACRO1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_MACRO2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_MACRO3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_MACRO4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_MACRO5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_6, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_7, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_8, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_9, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_10, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_OEM_11, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_EUR_1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_EUR_2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_JPN_1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_JPN_2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_JPN_3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_JPN_4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_JPN_5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_1, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_2, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_3, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_4, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_5, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_6, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_KOR_7, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZLED::RZLED_LOGO, Keyboard::MAX_COLUMN),
+			MakeKeyLocation(Keyboard::RZKEY::RZKEY_INVALID, Keyboard::MAX_COLUMN)
+		};
+
+		// mouse locations in EChromaSDKMouseLed order
+		constexpr FKeyLocation MOUSE_LEDS[] =
+		{
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_SCROLLWHEEL, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LOGO, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_BACKLIGHT, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE1, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE2, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE3, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE4, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE5, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE6, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_LEFT_SIDE7, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_BOTTOM1, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_BOTTOM2, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_BOTTOM3, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_BOTTOM4, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_BOTTOM5, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE1, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE2, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE3, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE4, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE5, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE6, Mouse::MAX_COLUMN),
+			MakeKeyLocation(Mouse::RZLED2::RZLED2_RIGHT_SIDE7, Mouse::MAX_COLUMN)
+		};
+
+		constexpr int KEYBOARD_KEY_COUNT = sizeof(KEYBOARD_KEYS) / sizeof(FKeyLocation);
+		constexpr int MOUSE_LED_COUNT = sizeof(MOUSE_LEDS) / sizeof(FKeyLocation);
+
+		static_assert(KEYBOARD_KEY_COUNT == (int)EChromaSDKKeyboardKey::KK_INVALID + 1, "KEYBOARD_KEYS must match EChromaSDKKeyboardKey");
+		static_assert(MOUSE_LED_COUNT == (int)EChromaSDKMouseLed::ML_RIGHT_SIDE7 + 1, "MOUSE_LEDS must match EChromaSDKMouseLed");
+
+		constexpr const FKeyLocation& GetKeyboardLocation(EChromaSDKKeyboardKey key)
+		{
+			return (int)key < KEYBOARD_KEY_COUNT ? KEYBOARD_KEYS[(int)key] : KEYBOARD_KEYS[(int)EChromaSDKKeyboardKey::KK_INVALID];
+		}
+
+		constexpr int GetKeyboardRzKey(EChromaSDKKeyboardKey key)
+		{
+			return GetKeyboardLocation(key).RzKey;
+		}
+
+		constexpr bool IsValidMouseLed(EChromaSDKMouseLed led)
+		{
+			return (int)led < MOUSE_LED_COUNT;
+		}
+
+		constexpr const FKeyLocation& GetMouseLocation(EChromaSDKMouseLed led)
+		{
+			return IsValidMouseLed(led) ? MOUSE_LEDS[(int)led] : MOUSE_LEDS[0];
+		}
+	}
+}
+
+#endif
@@ -10,8 +10,13 @@
 #include "RzChromaSDKDefines.h"
 #include "RzChromaSDKTypes.h"
 #include "RzErrors.h"
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
+#include "ChromaRegistry.h"
 #include "ChromaSDKDevice1DEnum.h"
 #include "ChromaSDKDevice2DEnum.h"
 
@@ -34,8 +39,26 @@ typedef RZRESULT(*CHROMA_SDK_QUERY_DEVICE)(RZDEVICEID DeviceId, ChromaSDK::DEVIC
 namespace ChromaSDK
 {
 	class AnimationBase;
+	class Animation2D;
+	class AnimationInstance;
+	class AnimationComposite;
+	class AnimationSequence;
+	class AnimationStateMachine;
+	class ChromaEffectPlayer;
+	class ChromaRecorder;
 }
 
+struct FChromaSDKKeySet;
+class FChromaEventDispatcher;
+
+#if PLATFORM_WINDOWS
+// the registry hands an animation to ChromaThread once the last reference is gone
+struct FRetireAnimation
+{
+	void operator()(ChromaSDK::AnimationBase* animation) const;
+};
+#endif
+
 class FChromaSDKPluginModule : public IModuleInterface
 {
 public:
@@ -67,8 +90,16 @@ public:
 	RZRESULT ChromaSDKCreateKeypadEffect(ChromaSDK::Keypad::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId);
 	RZRESULT ChromaSDKCreateMouseEffect(ChromaSDK::Mouse::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId);
 	RZRESULT ChromaSDKCreateMousepadEffect(ChromaSDK::Mousepad::EFFECT_TYPE effect, PRZPARAM pParam, RZEFFECTID* pEffectId);
+	// the device of the effect is not known, every device counts as shown
 	RZRESULT ChromaSDKSetEffect(RZEFFECTID effectId);
+	// set an effect that shows on the device, pShowCount receives the show count the set left on it
+	RZRESULT ChromaSDKSetEffect(RZEFFECTID effectId, int deviceType, int device, unsigned int* pShowCount);
+	// bumped by everything that shows an effect on the device, tells an animation whether its frame is still showing
+	unsigned int GetShowCount(int deviceType, int device);
 	RZRESULT ChromaSDKDeleteEffect(RZEFFECTID effectId);
+	// create a custom effect from packed BGR colors, a null effect id applies it right away
+	RZRESULT CreateEffectCustom1D(const EChromaSDKDevice1DEnum& device, const COLORREF* colors, RZEFFECTID* pEffectId);
+	RZRESULT CreateEffectCustom2D(const EChromaSDKDevice2DEnum& device, const COLORREF* colors, RZEFFECTID* pEffectId);
 
 	static int ToBGR(const FLinearColor& color);
 	static FLinearColor ToLinearColor(int color);
@@ -79,14 +110,82 @@ public:
 	int CloseAnimation(int animationId);
 	int CloseAnimationName(const char* path);
 	int GetAnimation(const char* path);
+	int DuplicateAnimation(int animationId);
+	int DuplicateAnimationName(const char* path);
+	// instanced playback, each instance plays the animation frames with its own playhead and transform
+	int CreateInstance(int animationId);
+	int CreateInstanceName(const char* path);
+	void DestroyInstance(int instanceId);
+	void PlayInstance(int instanceId, bool loop);
+	void StopInstance(int instanceId);
+	void SetInstanceSpeed(int instanceId, float speed);
+	void SetInstanceIntensity(int instanceId, float intensity);
+	void SetInstanceOffset(int instanceId, int rowOffset, int columnOffset);
+	void SetInstanceDevice(int instanceId, int device);
+	// playlists that ChromaThread advances without gaps between items
+	int CreateSequence();
+	void DestroySequence(int sequenceId);
+	int AddSequenceItem(int sequenceId, int animationId, int loopCount);
+	int AddSequenceItemName(int sequenceId, const char* path, int loopCount);
+	void ClearSequence(int sequenceId);
+	void PlaySequence(int sequenceId, bool loop);
+	void StopSequence(int sequenceId);
+	bool IsSequencePlaying(int sequenceId);
+	// lighting state graphs evaluated on ChromaThread, the game drives them with parameters
+	int CreateStateMachine();
+	void DestroyStateMachine(int stateMachineId);
+	int AddStateMachineState(int stateMachineId, bool loop);
+	bool AddStateMachineAnimation(int stateMachineId, int state, int animationId);
+	bool AddStateMachineAnimationName(int stateMachineId, int state, const char* path);
+	int AddStateMachineTransition(int stateMachineId, int fromState, int toState, int parameter, int compare, float value, float blendTime, int transition);
+	void SetStateMachineParameter(int stateMachineId, int parameter, float value);
+	int GetStateMachineState(int stateMachineId);
+	void PlayStateMachine(int stateMachineId, int state);
+	void StopStateMachine(int stateMachineId);
+	// resample the animation to another device, results are cached per source, device and kernel
+	int RetargetAnimation(int animationId, int device, int kernel);
+	int RetargetAnimationName(const char* path, int device, int kernel);
+	// play the animation on its device and retargeted copies on every other device
+	void PlayAnimationRetargeted(int animationId, bool loop);
+	// start a group of animations on the same tick so they share one timeline
+	void PlayAnimations(const int* animationIds, int count, bool loop);
+	void PlayAnimationRetargetedName(const char* path, bool loop);
+	void StopAnimationRetargeted(int animationId);
+	void StopAnimationRetargetedName(const char* path);
+	// multi-device animations from a single composite file, every track starts on the same tick
+	int OpenComposite(const char* path);
+	int GetComposite(const char* path);
+	int CloseComposite(int compositeId);
+	int CloseCompositeName(const char* path);
+	void PlayComposite(int compositeId, bool loop);
+	void PlayCompositeName(const char* path, bool loop);
+	void StopComposite(int compositeId);
+	void StopCompositeName(const char* path);
+	int GetCompositeTrack(int compositeId, int device);
+	// write loaded animations to a composite file, one animation per device
+	int SaveComposite(const char* path, const int* animationIds, int count);
+	// time scale and pause for all playback, per animation and per composite, lock free so they can change every frame
+	void SetPlaybackTimeScale(float timeScale);
+	void SetPlaybackPaused(bool paused);
+	void SetAnimationTimeScale(int animationId, float timeScale);
+	void SetAnimationPaused(int animationId, bool paused);
+	void SetCompositeTimeScale(int compositeId, float timeScale);
+	void SetCompositePaused(int compositeId, bool paused);
+	// loop and completion delegates, game thread only
+	FChromaEventDispatcher* GetEventDispatcher();
 	int GetAnimationIdFromInstance(ChromaSDK::AnimationBase* animation);
-	ChromaSDK::AnimationBase* GetAnimationInstance(int animationId);
+	// the animation stays valid while the pointer is held, even if another thread closes it
+	std::shared_ptr<ChromaSDK::AnimationBase> GetAnimationInstance(int animationId);
 	const char* GetAnimationName(int animationId);
 	int GetAnimationCount();
 	int GetAnimationId(int index);
 	int GetPlayingAnimationCount();
 	int GetPlayingAnimationId(int index);
 	void PlayAnimation(int animationId, bool loop);
+	// blend from the animation playing on the device into this one over the duration in seconds,
+	// plays right away when nothing is playing on the device
+	void PlayAnimationTransition(int animationId, bool loop, int transition, float duration);
+	void PlayAnimationTransitionName(const char* path, bool loop, int transition, float duration);
 	void PlayAnimationName(const char* path, bool loop);
 	void StopAnimation(int animationId);
 	void StopAnimationName(const char* path);
@@ -104,17 +203,75 @@ public:
 	void CopyKeyColorName(const char* sourceAnimation, const char* targetAnimation, int frameId, int rzkey);
 	void CopyNonZeroKeyColor(int sourceAnimationId, int targetAnimationId, int frameId, int rzkey);
 	void CopyNonZeroKeyColorName(const char* sourceAnimation, const char* targetAnimation, int frameId, int rzkey);
+	void SetKeySetColor(int animationId, int frameId, const FChromaSDKKeySet& keySet, COLORREF color);
+	void SetKeySetColorName(const char* path, int frameId, const FChromaSDKKeySet& keySet, COLORREF color);
+	void SetKeySetColorAllFrames(int animationId, const FChromaSDKKeySet& keySet, COLORREF color);
+	void SetKeySetColorAllFramesName(const char* path, const FChromaSDKKeySet& keySet, COLORREF color);
+	void CopyKeySetColor(int sourceAnimationId, int targetAnimationId, int frameId, const FChromaSDKKeySet& keySet);
+	void CopyKeySetColorName(const char* sourceAnimation, const char* targetAnimation, int frameId, const FChromaSDKKeySet& keySet);
+	void CopyKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet);
+	void CopyKeySetColorAllFramesName(const char* sourceAnimation, const char* targetAnimation, const FChromaSDKKeySet& keySet);
+	void CopyNonZeroKeySetColor(int sourceAnimationId, int targetAnimationId, int frameId, const FChromaSDKKeySet& keySet);
+	void CopyNonZeroKeySetColorName(const char* sourceAnimation, const char* targetAnimation, int frameId, const FChromaSDKKeySet& keySet);
+	void CopyNonZeroKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet);
+	void CopyNonZeroKeySetColorAllFramesName(const char* sourceAnimation, const char* targetAnimation, const FChromaSDKKeySet& keySet);
+	void FillFrames(int animationId, int startFrame, int endFrame, COLORREF color);
+	void FillFramesName(const char* path, int startFrame, int endFrame, COLORREF color);
+	void MultiplyFrames(int animationId, int startFrame, int endFrame, float intensity);
+	void MultiplyFramesName(const char* path, int startFrame, int endFrame, float intensity);
+	void ShiftFrames(int animationId, int startFrame, int endFrame, int rowOffset, int columnOffset);
+	void ShiftFramesName(const char* path, int startFrame, int endFrame, int rowOffset, int columnOffset);
+	void ReverseFrames(int animationId, int startFrame, int endFrame);
+	void ReverseFramesName(const char* path, int startFrame, int endFrame);
+	void DuplicateFrames(int animationId, int startFrame, int endFrame);
+	void DuplicateFramesName(const char* path, int startFrame, int endFrame);
+	void TrimFrames(int animationId, int startFrame, int endFrame);
+	void TrimFramesName(const char* path, int startFrame, int endFrame);
+	void ReplaceColor(int animationId, COLORREF color, COLORREF newColor);
+	void ReplaceColorName(const char* path, COLORREF color, COLORREF newColor);
+	void CopyFramesRegion(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns);
+	void CopyFramesRegionName(const char* sourceAnimation, const char* targetAnimation, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns);
+	void CopyNonZeroFrames(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame);
+	void CopyNonZeroFramesName(const char* sourceAnimation, const char* targetAnimation, int startFrame, int endFrame);
 	void LoadAnimation(int animationId);
 	void LoadAnimationName(const char* path);
 	void UnloadAnimation(int animationId);
 	void UnloadAnimationName(const char* path);
+	// route effects to the recorder instead of the SDK, nullptr restores the SDK, animations are unloaded on each switch
+	void SetRecorder(ChromaSDK::ChromaRecorder* recorder);
 #endif
 
 private:
 #if PLATFORM_WINDOWS
 	bool ValidateGetProcAddress(bool condition, FString methodName);
+	std::shared_ptr<ChromaSDK::Animation2D> GetKeyboardAnimation(int animationId);
+	// call with the object mutex held
+	ChromaSDK::AnimationInstance* GetInstance(int instanceId);
+	ChromaSDK::AnimationSequence* GetSequence(int sequenceId);
+	ChromaSDK::AnimationStateMachine* GetStateMachine(int stateMachineId);
+	// the published animation tables, readers hold the snapshot they loaded and never take a lock
+	typedef ChromaSDK::ChromaRegistry<ChromaSDK::AnimationBase, FRetireAnimation> FAnimationRegistry;
+	std::shared_ptr<const FAnimationRegistry::FSnapshot> GetAnimationLookup();
+	// store the id on the animation and publish it, returns the id the name is registered under
+	int RegisterAnimation(int animationId, ChromaSDK::AnimationBase* animation, const char* name);
+	// read one animation from the stream, composites call this once per track
+	ChromaSDK::AnimationBase* ReadAnimation(FILE* stream);
+	// stop whatever plays on the animation's device and make it the playing animation
+	void ClaimDevice(int animationId, ChromaSDK::AnimationBase* animation);
+	// nullptr for devices out of range
+	std::atomic<int>* GetPlayMapSlot(int deviceType, int device);
+	std::atomic<unsigned int>* GetShowCountSlot(int deviceType, int device);
+	// returns the new show count of the device
+	unsigned int MarkShown(int deviceType, int device);
+	void MarkAllShown();
+	RZRESULT ApplyEffect(RZEFFECTID effectId);
+	void CloseRetargets(int animationId);
+	void SetKeySetColorFrames(int animationId, int startFrame, int endFrame, const FChromaSDKKeySet& keySet, COLORREF color);
+	void CopyKeySetColorFrames(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame, const FChromaSDKKeySet& keySet, bool nonZero);
 
 	bool _mInitialized;
+	ChromaSDK::ChromaRecorder* _mRecorder;
+	FChromaEventDispatcher* _mEventDispatcher;
 
 	HMODULE _mLibraryChroma = nullptr;
 
@@ -131,10 +288,29 @@ private:
 	CHROMA_SDK_DELETE_EFFECT _mMethodDeleteEffect = NULL;
 	CHROMA_SDK_QUERY_DEVICE _mMethodQueryDevice = NULL;
 
-	int _mAnimationId;
-	std::map<std::string, int> _mAnimationMapID;
-	std::map<int, ChromaSDK::AnimationBase*> _mAnimations;
-	std::map<EChromaSDKDevice1DEnum, int> _mPlayMap1D;
-	std::map<EChromaSDKDevice2DEnum, int> _mPlayMap2D;
+	std::atomic<int> _mAnimationId;
+	FAnimationRegistry _mAnimations;
+	// animation id playing on each device, -1 for none
+	static const int PLAY_MAP_1D_SIZE = (int)EChromaSDKDevice1DEnum::DE_Mousepad + 1;
+	static const int PLAY_MAP_2D_SIZE = (int)EChromaSDKDevice2DEnum::DE_Mouse + 1;
+	std::atomic<int> _mPlayMap1D[PLAY_MAP_1D_SIZE];
+	std::atomic<int> _mPlayMap2D[PLAY_MAP_2D_SIZE];
+	// effects shown on each device by any writer, animations, canvases, transitions and players
+	std::atomic<unsigned int> _mShowCount1D[PLAY_MAP_1D_SIZE];
+	std::atomic<unsigned int> _mShowCount2D[PLAY_MAP_2D_SIZE];
+	// guards the instance, retarget, composite, sequence and state machine tables below,
+	// recursive because closing an animation cascades through them
+	std::recursive_mutex _mObjectMutex;
+	int _mInstanceId;
+	std::map<int, ChromaSDK::AnimationInstance*> _mInstances;
+	// (source id, device, kernel) to the retargeted animation id and the source version it was made from
+	std::map<std::tuple<int, int, int>, std::pair<int, unsigned int>> _mRetargets;
+	int _mCompositeId;
+	std::map<std::string, int> _mCompositeMapID;
+	std::map<int, ChromaSDK::AnimationComposite*> _mComposites;
+	int _mSequenceId;
+	std::map<int, ChromaSDK::AnimationSequence*> _mSequences;
+	int _mStateMachineId;
+	std::map<int, ChromaSDK::AnimationStateMachine*> _mStateMachines;
 #endif
 };
@@ -59,6 +59,8 @@ public:
 	TStatId GetStatId() const override;
 	/* Implements FTickableGameObject */
 
+	void BeginDestroy() override;
+
 #if WITH_EDITOR
 	void Reset(EChromaSDKDevice2DEnum device);
 	void RefreshColors();
@@ -67,6 +69,8 @@ public:
 
 private:
 	float GetTime(int index);
+	// hand the loaded effects to the player
+	void PlayEffects();
 
 	// Callback when animation completes
 	FDelegateChomaSDKOnComplete2D _mOnComplete;
@@ -74,8 +78,12 @@ private:
 	// Effects needs to be loaded before the animation can be played
 	bool _mIsLoaded;
 
+	// stays set until the completion reaches the game thread
 	bool _mIsPlaying;
-	float _mTime;
-	int _mCurrentFrame;
 	TArray<FChromaSDKEffectResult> _mEffects;
+
+#if PLATFORM_WINDOWS
+	// frames advance and effects are set on ChromaThread
+	ChromaSDK::ChromaEffectPlayer* _mPlayer;
+#endif
 };
@@ -5,11 +5,10 @@
 #include "ChromaSDKPlugin.h"
 #include "Engine.h"
 #include "ChromaSDKPluginTypes.h"
-#if PLATFORM_WINDOWS
-#include <map>
-#endif
 #include "ChromaSDKPluginBPLibrary.generated.h"
 
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateChromaSDKAnimationEvent, const FString&, animationName, EChromaSDKAnimationEventEnum, animationEvent);
+
 /* 
 *	Function library class.
 *	Each function in it is expected to be static and represents blueprint node that can be called in any blueprint.
@@ -113,6 +112,12 @@ class CHROMASDKPLUGIN_API UChromaSDKPluginBPLibrary : public UBlueprintFunctionL
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CloseAnimationName", Keywords = "Close the *.chroma Animation"), Category = "ChromaSDK")
 	static void CloseAnimationName(const FString& animationName);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DuplicateAnimation", Keywords = "Copy the animation and return the new animation id, frames are shared until either animation is edited"), Category = "ChromaSDK")
+	static int DuplicateAnimation(const int animationId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DuplicateAnimationName", Keywords = "Copy the animation and return the new animation id, frames are shared until either animation is edited"), Category = "ChromaSDK")
+	static int DuplicateAnimationName(const FString& animationName);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "UnloadAnimation", Keywords = "Unload the *.chroma Animation"), Category = "ChromaSDK")
 	static void UnloadAnimation(const int animationId);
 
@@ -125,6 +130,93 @@ class CHROMASDKPLUGIN_API UChromaSDKPluginBPLibrary : public UBlueprintFunctionL
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopAnimation", Keywords = "Stop the *.chroma Animation"), Category = "ChromaSDK")
 	static void StopAnimation(const FString& animationName);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlayAnimationId", Keywords = "Play the Animation by id, use with duplicated animations"), Category = "ChromaSDK")
+	static void PlayAnimationId(const int animationId, bool loop);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopAnimationId", Keywords = "Stop the Animation by id, use with duplicated animations"), Category = "ChromaSDK")
+	static void StopAnimationId(const int animationId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CreateInstanceName", Keywords = "Create a playback instance of the animation and return the instance id, instances share the animation frames"), Category = "ChromaSDK")
+	static int CreateInstanceName(const FString& animationName);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DestroyInstance", Keywords = "Stop and remove the playback instance"), Category = "ChromaSDK")
+	static void DestroyInstance(const int instanceId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlayInstance", Keywords = "Play the instance from the first frame"), Category = "ChromaSDK")
+	static void PlayInstance(const int instanceId, bool loop);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopInstance", Keywords = "Stop the instance"), Category = "ChromaSDK")
+	static void StopInstance(const int instanceId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetInstanceSpeed", Keywords = "Scale the instance playback speed, 1 is normal speed"), Category = "ChromaSDK")
+	static void SetInstanceSpeed(const int instanceId, float speed);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetInstanceIntensity", Keywords = "Multiply the instance colors by the intensity"), Category = "ChromaSDK")
+	static void SetInstanceIntensity(const int instanceId, float intensity);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetInstanceOffset", Keywords = "Offset the instance on the device grid, 1D devices use the column offset"), Category = "ChromaSDK")
+	static void SetInstanceOffset(const int instanceId, int rowOffset, int columnOffset);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetInstanceDevice", Keywords = "Show the instance on another device"), Category = "ChromaSDK")
+	static void SetInstanceDevice(const int instanceId, const EChromaSDKDeviceEnum& device);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CreateSequence", Keywords = "Create an empty animation sequence and return the sequence id"), Category = "ChromaSDK")
+	static int CreateSequence();
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DestroySequence", Keywords = "Stop and remove the sequence"), Category = "ChromaSDK")
+	static void DestroySequence(const int sequenceId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "AddSequenceItem", Keywords = "Append an animation played loopCount times to the sequence and return the item index"), Category = "ChromaSDK")
+	static int AddSequenceItem(const int sequenceId, const FString& animationName, int loopCount);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ClearSequence", Keywords = "Stop the sequence and remove its items"), Category = "ChromaSDK")
+	static void ClearSequence(const int sequenceId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlaySequence", Keywords = "Play the sequence items back to back from the first item"), Category = "ChromaSDK")
+	static void PlaySequence(const int sequenceId, bool loop);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopSequence", Keywords = "Stop the sequence"), Category = "ChromaSDK")
+	static void StopSequence(const int sequenceId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "IsSequencePlaying", Keywords = "Check if the sequence is playing"), Category = "ChromaSDK")
+	static bool IsSequencePlaying(const int sequenceId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CreateStateMachine", Keywords = "Create a lighting state machine from states and transitions and return the state machine id"), Category = "ChromaSDK")
+	static int CreateStateMachine(const TArray<FChromaSDKLightingState>& states, const TArray<FChromaSDKLightingTransition>& transitions);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DestroyStateMachine", Keywords = "Stop and remove the state machine"), Category = "ChromaSDK")
+	static void DestroyStateMachine(const int stateMachineId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlayStateMachine", Keywords = "Enter the state and start evaluating the transitions"), Category = "ChromaSDK")
+	static void PlayStateMachine(const int stateMachineId, int state);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopStateMachine", Keywords = "Stop the state machine and the animations of its state"), Category = "ChromaSDK")
+	static void StopStateMachine(const int stateMachineId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetStateMachineParameter", Keywords = "Set a parameter the transition conditions compare with, safe to call every frame"), Category = "ChromaSDK")
+	static void SetStateMachineParameter(const int stateMachineId, int parameter, float value);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "GetStateMachineState", Keywords = "Get the current state index of the state machine"), Category = "ChromaSDK")
+	static int GetStateMachineState(const int stateMachineId);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "BindAnimationEvents", Keywords = "Call the event on the game thread when the animation loops or completes, replaces the previous binding"), Category = "ChromaSDK")
+	static void BindAnimationEvents(const FString& animationName, const FDelegateChromaSDKAnimationEvent& onEvent);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "UnbindAnimationEvents", Keywords = "Stop calling the event bound to the animation"), Category = "ChromaSDK")
+	static void UnbindAnimationEvents(const FString& animationName);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "RetargetAnimationName", Keywords = "Resample the animation to another device and return the animation id, the result is cached until the source is edited"), Category = "ChromaSDK")
+	static int RetargetAnimationName(const FString& animationName, const EChromaSDKDeviceEnum& device, const EChromaSDKRetargetKernel& kernel);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlayAnimationRetargeted", Keywords = "Play the animation on every device, other devices play a resampled copy"), Category = "ChromaSDK")
+	static void PlayAnimationRetargeted(const FString& animationName, bool loop);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopAnimationRetargeted", Keywords = "Stop the animation and its resampled copies"), Category = "ChromaSDK")
+	static void StopAnimationRetargeted(const FString& animationName);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlayAnimationTransition", Keywords = "Blend from the animation playing on the device into this animation"), Category = "ChromaSDK")
+	static void PlayAnimationTransition(const FString& animationName, bool loop, const EChromaSDKTransitionEnum& transition, float duration);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopAnimationType", Keywords = "Stop playing the Animation type"), Category = "ChromaSDK")
 	static void StopAnimationType(const EChromaSDKDeviceEnum& device);
 
@@ -167,6 +259,36 @@ class CHROMASDKPLUGIN_API UChromaSDKPluginBPLibrary : public UBlueprintFunctionL
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopAnimationComposite", Keywords = "Stop a set of *_Device.chroma Animations"), Category = "ChromaSDK")
 	static void StopAnimationComposite(const FString& animationName);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "PlayComposite", Keywords = "Play a single file composite Animation, every device track starts on the same update"), Category = "ChromaSDK")
+	static void PlayComposite(const FString& animationName, bool loop);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "StopComposite", Keywords = "Stop a single file composite Animation"), Category = "ChromaSDK")
+	static void StopComposite(const FString& animationName);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CloseComposite", Keywords = "Close a single file composite Animation and its tracks"), Category = "ChromaSDK")
+	static void CloseComposite(const FString& animationName);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SaveComposite", Keywords = "Combine a set of *_Device.chroma Animations into a single composite file"), Category = "ChromaSDK")
+	static int SaveComposite(const FString& animationName);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetPlaybackTimeScale", Keywords = "Scale the speed of all Chroma playback, 0 holds the current frames"), Category = "ChromaSDK")
+	static void SetPlaybackTimeScale(float timeScale);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetPlaybackPaused", Keywords = "Pause or resume all Chroma playback"), Category = "ChromaSDK")
+	static void SetPlaybackPaused(bool paused);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetAnimationTimeScale", Keywords = "Scale the speed of one Animation on top of the playback time scale"), Category = "ChromaSDK")
+	static void SetAnimationTimeScale(const FString& animationName, float timeScale);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetAnimationPaused", Keywords = "Pause or resume one Animation"), Category = "ChromaSDK")
+	static void SetAnimationPaused(const FString& animationName, bool paused);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetCompositeTimeScale", Keywords = "Scale the speed of every track of a composite Animation"), Category = "ChromaSDK")
+	static void SetCompositeTimeScale(const FString& animationName, float timeScale);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetCompositePaused", Keywords = "Pause or resume every track of a composite Animation"), Category = "ChromaSDK")
+	static void SetCompositePaused(const FString& animationName, bool paused);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "GetKeyColor", Keywords = "Get the color from the animation frame's key"), Category = "ChromaSDK")
 	static FLinearColor GetKeyColor(int animationId, int frameIndex, const EChromaSDKKeyboardKey& key);
 
@@ -245,18 +367,152 @@ class CHROMASDKPLUGIN_API UChromaSDKPluginBPLibrary : public UBlueprintFunctionL
 //	static void CopyNonZeroKeysColorAllFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, const TArray<TEnumAsByte<EChromaSDKKeyboardKey>>& keys); //(support 4.13 and below)___HACK_UE4_WANTS_GAME_MODE
 	static void CopyNonZeroKeysColorAllFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, const TArray<EChromaSDKKeyboardKey>& keys); //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CreateKeySet", Keywords = "Create a reusable key set from a set of keys"), Category = "ChromaSDK")
+//	static FChromaSDKKeySet CreateKeySet(const TArray<TEnumAsByte<EChromaSDKKeyboardKey>>& keys); //(support 4.13 and below)___HACK_UE4_WANTS_GAME_MODE
+	static FChromaSDKKeySet CreateKeySet(const TArray<EChromaSDKKeyboardKey>& keys); //(support above 4.13)___HACK_UE4_WANTS_BASE_GAME_MODE
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetKeySetColor", Keywords = "Set the animation frame to the supplied color for a key set"), Category = "ChromaSDK")
+	static void SetKeySetColor(int animationId, int frameIndex, const FChromaSDKKeySet& keySet, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetKeySetColorName", Keywords = "Set the animation frame to the supplied color for a key set"), Category = "ChromaSDK")
+	static void SetKeySetColorName(const FString& animationName, const int frameIndex, const FChromaSDKKeySet& keySet, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetKeySetColorAllFrames", Keywords = "Set the key set to the supplied color for all animation frames"), Category = "ChromaSDK")
+	static void SetKeySetColorAllFrames(int animationId, const FChromaSDKKeySet& keySet, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "SetKeySetColorAllFramesName", Keywords = "Set the key set to the supplied color for all animation frames"), Category = "ChromaSDK")
+	static void SetKeySetColorAllFramesName(const FString& animationName, const FChromaSDKKeySet& keySet, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyKeySetColor", Keywords = "Copy color from a source animation to a target animation for a key set"), Category = "ChromaSDK")
+	static void CopyKeySetColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyKeySetColorName", Keywords = "Copy color from a source animation to a target animation for a key set"), Category = "ChromaSDK")
+	static void CopyKeySetColorName(const FString& sourceAnimationName, const FString& targetAnimationName, const int frameIndex, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyKeySetColorAllFrames", Keywords = "Copy color from a source animation to a target animation for a key set for all frames"), Category = "ChromaSDK")
+	static void CopyKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyKeySetColorAllFramesName", Keywords = "Copy color from a source animation to a target animation for a key set for all frames"), Category = "ChromaSDK")
+	static void CopyKeySetColorAllFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyNonZeroKeySetColor", Keywords = "Copy nonzero color from a source animation to a target animation for a key set"), Category = "ChromaSDK")
+	static void CopyNonZeroKeySetColor(int sourceAnimationId, int targetAnimationId, int frameIndex, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyNonZeroKeySetColorName", Keywords = "Copy nonzero color from a source animation to a target animation for a key set"), Category = "ChromaSDK")
+	static void CopyNonZeroKeySetColorName(const FString& sourceAnimationName, const FString& targetAnimationName, const int frameIndex, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyNonZeroKeySetColorAllFrames", Keywords = "Copy nonzero color from a source animation to a target animation for a key set for all frames"), Category = "ChromaSDK")
+	static void CopyNonZeroKeySetColorAllFrames(int sourceAnimationId, int targetAnimationId, const FChromaSDKKeySet& keySet);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyNonZeroKeySetColorAllFramesName", Keywords = "Copy nonzero color from a source animation to a target animation for a key set for all frames"), Category = "ChromaSDK")
+	static void CopyNonZeroKeySetColorAllFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, const FChromaSDKKeySet& keySet);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "GetFrameCount", Keywords = "Get the .chroma animation frame count"), Category = "ChromaSDK")
 	static int GetFrameCount(const int animationId);
 
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "GetFrameCountName", Keywords = "Get the .chroma animation frame count"), Category = "ChromaSDK")
 	static int GetFrameCountName(const FString& animationName);
 
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "FillFrames", Keywords = "Set all keys in the frame range to the supplied color, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void FillFrames(int animationId, int startFrame, int endFrame, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "FillFramesName", Keywords = "Set all keys in the frame range to the supplied color, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void FillFramesName(const FString& animationName, int startFrame, int endFrame, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "MultiplyFrames", Keywords = "Multiply the color intensity for the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void MultiplyFrames(int animationId, int startFrame, int endFrame, float intensity);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "MultiplyFramesName", Keywords = "Multiply the color intensity for the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void MultiplyFramesName(const FString& animationName, int startFrame, int endFrame, float intensity);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ShiftFrames", Keywords = "Shift the colors in the frame range by a row and column offset, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void ShiftFrames(int animationId, int startFrame, int endFrame, int rowOffset, int columnOffset);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ShiftFramesName", Keywords = "Shift the colors in the frame range by a row and column offset, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void ShiftFramesName(const FString& animationName, int startFrame, int endFrame, int rowOffset, int columnOffset);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReverseFrames", Keywords = "Reverse the order of the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void ReverseFrames(int animationId, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReverseFramesName", Keywords = "Reverse the order of the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void ReverseFramesName(const FString& animationName, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DuplicateFrames", Keywords = "Insert a copy of the frame range after the range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void DuplicateFrames(int animationId, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DuplicateFramesName", Keywords = "Insert a copy of the frame range after the range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void DuplicateFramesName(const FString& animationName, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "TrimFrames", Keywords = "Remove the frames outside of the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void TrimFrames(int animationId, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "TrimFramesName", Keywords = "Remove the frames outside of the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void TrimFramesName(const FString& animationName, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReplaceColor", Keywords = "Replace every use of a color in all frames, palette animations only update the palette"), Category = "ChromaSDK")
+	static void ReplaceColor(int animationId, const FLinearColor& color, const FLinearColor& newColor);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "ReplaceColorName", Keywords = "Replace every use of a color in all frames, palette animations only update the palette"), Category = "ChromaSDK")
+	static void ReplaceColorName(const FString& animationName, const FLinearColor& color, const FLinearColor& newColor);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyFramesRegion", Keywords = "Copy a region of color from a source animation to a target animation for the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void CopyFramesRegion(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyFramesRegionName", Keywords = "Copy a region of color from a source animation to a target animation for the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void CopyFramesRegionName(const FString& sourceAnimationName, const FString& targetAnimationName, int startFrame, int endFrame, int startRow, int startColumn, int rows, int columns);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyNonZeroFrames", Keywords = "Copy nonzero color from a source animation to a target animation for the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void CopyNonZeroFrames(int sourceAnimationId, int targetAnimationId, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CopyNonZeroFramesName", Keywords = "Copy nonzero color from a source animation to a target animation for the frame range, endFrame -1 selects through the last frame"), Category = "ChromaSDK")
+	static void CopyNonZeroFramesName(const FString& sourceAnimationName, const FString& targetAnimationName, int startFrame, int endFrame);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CanvasFill", Keywords = "Fill the device live canvas with the supplied color, call CanvasCommit to show it"), Category = "ChromaSDK")
+	static void CanvasFill(const EChromaSDKDeviceEnum& device, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CanvasSetColors1D", Keywords = "Copy 1D colors into the device live canvas, call CanvasCommit to show it"), Category = "ChromaSDK")
+	static void CanvasSetColors1D(const EChromaSDKDevice1DEnum& device, const TArray<FLinearColor>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CanvasSetColors2D", Keywords = "Copy 2D colors into the device live canvas, call CanvasCommit to show it"), Category = "ChromaSDK")
+	static void CanvasSetColors2D(const EChromaSDKDevice2DEnum& device, const TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CanvasSetKeyColor", Keywords = "Set a key on the keyboard live canvas, call CanvasCommit to show it"), Category = "ChromaSDK")
+	static void CanvasSetKeyColor(const EChromaSDKKeyboardKey& key, const FLinearColor& color);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "CanvasCommit", Keywords = "Show the device live canvas on the next ChromaThread tick"), Category = "ChromaSDK")
+	static void CanvasCommit(const EChromaSDKDeviceEnum& device);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawRect2D", Keywords = "Fill a rectangle in the 2D colors, clipped to the grid"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& DrawRect2D(int row, int column, int rows, int columns, const FLinearColor& color, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawHorizontalBar2D", Keywords = "Fill the left part of the rows in the 2D colors, amount is 0 to 1"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& DrawHorizontalBar2D(int row, int rows, float amount, const FLinearColor& color, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawVerticalBar2D", Keywords = "Fill the bottom part of the columns in the 2D colors, amount is 0 to 1"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& DrawVerticalBar2D(int column, int columns, float amount, const FLinearColor& color, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawLine2D", Keywords = "Draw a line between two cells in the 2D colors"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& DrawLine2D(int startRow, int startColumn, int endRow, int endColumn, const FLinearColor& color, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawCircle2D", Keywords = "Fill a circle in the 2D colors"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& DrawCircle2D(float centerRow, float centerColumn, float radius, const FLinearColor& color, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawGradient2D", Keywords = "Fill a rectangle in the 2D colors with a left to right gradient"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& DrawGradient2D(int row, int column, int rows, int columns, const FLinearColor& startColor, const FLinearColor& endColor, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "FloodFill2D", Keywords = "Flood fill the 2D colors from the seed cell"), Category = "ChromaSDK")
+	static const TArray<FChromaSDKColors>& FloodFill2D(int row, int column, const FLinearColor& color, UPARAM(ref) TArray<FChromaSDKColors>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawBar1D", Keywords = "Fill the start of the 1D colors, amount is 0 to 1"), Category = "ChromaSDK")
+	static const TArray<FLinearColor>& DrawBar1D(float amount, const FLinearColor& color, UPARAM(ref) TArray<FLinearColor>& colors);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "DrawGradient1D", Keywords = "Fill a range of the 1D colors with a gradient"), Category = "ChromaSDK")
+	static const TArray<FLinearColor>& DrawGradient1D(int start, int count, const FLinearColor& startColor, const FLinearColor& endColor, UPARAM(ref) TArray<FLinearColor>& colors);
+
 #if PLATFORM_WINDOWS
 private:
 	static void ToString(const RZEFFECTID& effectId, FString& effectString);
 	static void ToEffect(const FString& effectString, RZEFFECTID& effectId);
-	static std::map<EChromaSDKKeyboardKey, int> _sKeyboardEnumMap;
-	static std::map<EChromaSDKMouseLed, ChromaSDK::Mouse::RZLED2> _sMouseEnumMap;
 
 	static bool _sInitialized;
 #endif
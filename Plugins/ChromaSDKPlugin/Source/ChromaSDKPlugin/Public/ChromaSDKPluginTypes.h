@@ -42,6 +42,39 @@ enum class EChromaSDKDeviceEnum : uint8
 	DE_Mousepad		UMETA(DisplayName = "Mousepad")
 };
 
+UENUM(BlueprintType)
+enum class EChromaSDKRetargetKernel : uint8
+{
+	RK_AreaAverage	UMETA(DisplayName = "Area Average"),
+	RK_Bilinear		UMETA(DisplayName = "Bilinear")
+};
+
+UENUM(BlueprintType)
+enum class EChromaSDKTransitionEnum : uint8
+{
+	TE_Crossfade	UMETA(DisplayName = "Crossfade"),
+	TE_Wipe			UMETA(DisplayName = "Wipe"),
+	TE_Dissolve		UMETA(DisplayName = "Dissolve")
+};
+
+UENUM(BlueprintType)
+enum class EChromaSDKAnimationEventEnum : uint8
+{
+	AE_Loop			UMETA(DisplayName = "Loop"),
+	AE_Complete		UMETA(DisplayName = "Complete")
+};
+
+UENUM(BlueprintType)
+enum class EChromaSDKCompareEnum : uint8
+{
+	CE_Greater			UMETA(DisplayName = "Greater"),
+	CE_GreaterOrEqual	UMETA(DisplayName = "Greater Or Equal"),
+	CE_Less				UMETA(DisplayName = "Less"),
+	CE_LessOrEqual		UMETA(DisplayName = "Less Or Equal"),
+	CE_Equal			UMETA(DisplayName = "Equal"),
+	CE_NotEqual			UMETA(DisplayName = "Not Equal")
+};
+
 UENUM(BlueprintType)
 enum class EChromaSDKKeyboardKey : uint8
 {
@@ -291,3 +324,112 @@ struct CHROMASDKPLUGIN_API FChromaSDKColorFrame2D
 		Duration = 1;
 	}
 };
+
+USTRUCT(BlueprintType)
+struct CHROMASDKPLUGIN_API FChromaSDKKeySet
+{
+	GENERATED_BODY()
+
+	// one bit per keyboard grid cell (6 rows x 22 columns = 132 bits)
+	UPROPERTY()
+	uint32 Mask[5];
+
+	//Constructor
+	FChromaSDKKeySet()
+	{
+		Clear();
+	}
+
+	void Clear()
+	{
+		for (int i = 0; i < 5; ++i)
+		{
+			Mask[i] = 0;
+		}
+	}
+
+	void Add(int index)
+	{
+		if (index >= 0 &&
+			index < 160)
+		{
+			Mask[index >> 5] |= (1u << (index & 31));
+		}
+	}
+
+	bool Contains(int index) const
+	{
+		if (index >= 0 &&
+			index < 160)
+		{
+			return (Mask[index >> 5] & (1u << (index & 31))) != 0;
+		}
+		return false;
+	}
+
+	bool IsEmpty() const
+	{
+		return (Mask[0] | Mask[1] | Mask[2] | Mask[3] | Mask[4]) == 0;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct CHROMASDKPLUGIN_API FChromaSDKLightingState
+{
+	GENERATED_BODY()
+
+	// animation names, at most one per device
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FString> Animations;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool Loop;
+
+	//Constructor
+	FChromaSDKLightingState()
+	{
+		Loop = true;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct CHROMASDKPLUGIN_API FChromaSDKLightingTransition
+{
+	GENERATED_BODY()
+
+	// state index, -1 leaves from any state
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int FromState;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int ToState;
+
+	// taken when the parameter compares true with the value
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int Parameter;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EChromaSDKCompareEnum Compare;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Value;
+
+	// seconds, zero is a hard cut
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float BlendTime;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EChromaSDKTransitionEnum Transition;
+
+	//Constructor
+	FChromaSDKLightingTransition()
+	{
+		FromState = -1;
+		ToState = 0;
+		Parameter = 0;
+		Compare = EChromaSDKCompareEnum::CE_Greater;
+		Value = 0.0f;
+		BlendTime = 0.0f;
+		Transition = EChromaSDKTransitionEnum::TE_Crossfade;
+	}
+};
@@ -2,6 +2,15 @@
 
 #include "ChromaSDKPlugin.h"
 #include "AnimationBase.h"
+#include "AnimationInstance.h"
+#include "AnimationSequence.h"
+#include "AnimationStateMachine.h"
+#include "ChromaCanvas.h"
+#include "ChromaClock.h"
+#include "ChromaEffectPlayer.h"
+#include "ChromaEventQueue.h"
+#include "ChromaReclaimer.h"
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -14,17 +23,96 @@ namespace ChromaSDK
 		static ChromaThread* Instance();
 		void Start();
 		void Stop();
+		// advance playback by one step and present the output, the worker calls this with its clock
+		void Tick(float deltaTime);
+		// nullptr restores the real time clock
+		void SetClock(CHROMA_THREAD_CLOCK clock);
+		// while held the worker stops ticking so an offline renderer can step playback itself
+		void SetHold(bool hold);
+		// closed animations are never added, so a close can't race a play into the list
 		void AddAnimation(AnimationBase* animation);
+		// add under one lock so every animation gets its first update on the same tick
+		void AddAnimations(const std::vector<AnimationBase*>& animations);
+		// removing either side of a transition ends it and hands the device to the other side
 		void RemoveAnimation(AnimationBase* animation);
+		// blend from the playing animation to the started animation in the output stage,
+		// the outgoing animation finishes when the transition completes
+		void AddTransition(AnimationBase* from, AnimationBase* to, EChromaSDKDeviceEnum device, EChromaSDKTransitionEnum type, float duration);
+		// defer deleting a closed animation until no tick can still be using it,
+		// the animation must already be out of every list the tick reads
+		void Retire(AnimationBase* animation);
+		// delete the retired animations that are safe to delete, wait blocks for the tick in flight and deletes all of them
+		void Reclaim(bool wait);
+		// queue a loop or completion event from inside the tick, animations that are not registered with the module are skipped
+		void PostEvent(AnimationBase* animation, EChromaSDKAnimationEventEnum type);
+		// game thread side of the event queue
+		bool PopEvent(FChromaAnimationEvent& event);
 		int GetAnimationCount();
 		int GetAnimationId(int index);
+		void AddSequence(AnimationSequence* sequence);
+		// after this returns the sequence is no longer updated
+		void RemoveSequence(AnimationSequence* sequence);
+		void AddStateMachine(AnimationStateMachine* stateMachine);
+		// after this returns the state machine is no longer evaluated
+		void RemoveStateMachine(AnimationStateMachine* stateMachine);
+		void AddPlayer(ChromaEffectPlayer* player);
+		// after this returns the player is no longer updated
+		void RemovePlayer(ChromaEffectPlayer* player);
+		void AddInstance(AnimationInstance* instance);
+		// after this returns the output stage no longer touches the instance
+		void RemoveInstance(AnimationInstance* instance);
+		ChromaCanvas* GetCanvas(EChromaSDKDeviceEnum device);
+		// global playback time, lock free so game code can set it every frame
+		void SetTimeScale(float timeScale);
+		float GetTimeScale();
+		void SetPaused(bool paused);
+		bool IsPaused();
+		// the time step playback advances by, zero while paused
+		float ScaleTime(float deltaTime);
 	private:
 		ChromaThread();
 		void ChromaWorker();
+		// one tick of the pipeline, call with the tick mutex held
+		void Step(float deltaTime);
+		// composite the instances of devices whose instance output changed
+		void UpdateInstances(float deltaTime);
+		struct FTransition
+		{
+			AnimationBase* From;
+			AnimationBase* To;
+			EChromaSDKDeviceEnum Device;
+			EChromaSDKTransitionEnum Type;
+			float Duration;
+			float Time;
+		};
+		// advance the transitions and show the blended frames, call with the mutex held
+		void UpdateTransitions(float deltaTime);
+		void ShowTransition(const FTransition& transition);
+		// hand the device to the incoming animation, call with the mutex held
+		void EndTransition(unsigned int index);
+		void BeginTransition(AnimationBase* from, AnimationBase* to, EChromaSDKDeviceEnum device, EChromaSDKTransitionEnum type, float duration);
+		// start the animations of the next state, call with the mutex held
+		void ApplyStateChange(const AnimationStateMachine::FStateChange& change);
 		static ChromaThread* _sInstance;
+		static const int CANVAS_COUNT = (int)EChromaSDKDeviceEnum::DE_Mousepad + 1;
+		ChromaCanvas* _mCanvases[CANVAS_COUNT];
 		std::vector<AnimationBase*> _mAnimations;
+		std::vector<AnimationInstance*> _mInstances;
+		std::vector<AnimationSequence*> _mSequences;
+		std::vector<AnimationStateMachine*> _mStateMachines;
+		std::vector<ChromaEffectPlayer*> _mPlayers;
+		std::vector<FTransition> _mTransitions;
 		std::thread* _mThread;
 		std::mutex _mMutex;
 		bool _mWaitForExit;
+		std::atomic<float> _mTimeScale;
+		std::atomic<bool> _mPaused;
+		ChromaStepClock _mClock;
+		std::atomic<bool> _mHold;
+		// one tick at a time between the worker and an offline renderer
+		std::mutex _mTickMutex;
+		// closed animations wait here until no tick can still be using them
+		ChromaReclaimer<AnimationBase> _mReclaimer;
+		ChromaEventQueue _mEvents;
 	};
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace ChromaSDK
+{
+	// Scripted events on a fixed step timeline. The time of each step comes
+	// from the step count and not from a clock, so the same events and
+	// duration always produce the same steps.
+	// No engine includes so the standalone harness can build it.
+	class ChromaTimeline
+	{
+	public:
+		explicit ChromaTimeline(float stepTime)
+		{
+			_mStepTime = stepTime > 0.0f ? stepTime : 1.0f / 30.0f;
+		}
+
+		float GetStepTime()
+		{
+			return _mStepTime;
+		}
+
+		// the action runs before the first step at or after the time, events at the same time keep their order
+		void AddEvent(float time, const std::function<void()>& action)
+		{
+			FTimelineEvent timelineEvent;
+			timelineEvent.Time = time;
+			timelineEvent.Action = action;
+			_mEvents.push_back(timelineEvent);
+		}
+
+		// call the step from 0 to the duration with the step time, the events that are due run first
+		void Run(float duration, const std::function<void(float)>& step)
+		{
+			std::vector<FTimelineEvent> events = _mEvents;
+			std::stable_sort(events.begin(), events.end(),
+				[](const FTimelineEvent& a, const FTimelineEvent& b) { return a.Time < b.Time; });
+
+			const int steps = (int)std::ceil(duration / _mStepTime);
+			unsigned int next = 0;
+			for (int index = 0; index < steps; ++index)
+			{
+				//from the step count so the timeline does not collect rounding
+				const float time = index * _mStepTime;
+				while (next < events.size() &&
+					events[next].Time <= time)
+				{
+					events[next].Action();
+					++next;
+				}
+				step(_mStepTime);
+			}
+		}
+
+	private:
+		struct FTimelineEvent
+		{
+			float Time;
+			std::function<void()> Action;
+		};
+		float _mStepTime;
+		std::vector<FTimelineEvent> _mEvents;
+	};
+}